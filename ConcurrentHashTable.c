@@ -0,0 +1,897 @@
+/**
+ * @file ConcurrentHashTable.c
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A file for the Concurrent Hash Table. It defines a chained Hash Table whose
+ *        readers never take a lock, while writers publish their changes to them and free the
+ *        memory the readers may still hold only once no reader can reach it.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A file for the Concurrent Hash Table. It defines a chained Hash Table whose
+ * readers never take a lock, while writers publish their changes to them and free the
+ * memory the readers may still hold only once no reader can reach it.
+ * Input:       No particular input.
+ * Process:     A node is never changed after it is published, except for it's data, so a
+ *              reader walks a chain while a writer links or unlinks other nodes of it. A writer
+ *              links a node with a release store, and grows the table by copying it's nodes into
+ *              a new cells array which it publishes at once. An unlinked node or a replaced cells
+ *              array is retired with the epoch of the table, which the writer then advances, and
+ *              is freed once every Reader that is searching entered a later epoch.
+ *              Readers only write the epoch of their own Reader, which is on a cache line of
+ *              it's own, so searches share no written memory unless a writer changes the table.
+ *              The atomic operations are the __atomic builtins of gcc.
+ * Output:      No particular output.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <assert.h>
+#include <pthread.h>
+#include "TableErrorHandle.h"
+#include "MemoryPool.h"
+#include "HashReduction.h"
+#include "ConcurrentHashTable.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def INITIAL_INDEX 0
+ * @brief A Macro that sets the initial index for arrays and loops.
+ */
+#define INITIAL_INDEX 0
+
+/**
+ * @def MINIMAL_TABLE_SIZE 1
+ * @brief A Macro that sets the minimal size of a Concurrent Hash Table.
+ */
+#define MINIMAL_TABLE_SIZE 1
+
+/**
+ * @def MINIMAL_NUMBER_OF_READERS 1
+ * @brief A Macro that sets the minimal number of Readers of a Concurrent Hash Table.
+ */
+#define MINIMAL_NUMBER_OF_READERS 1
+
+/**
+ * @def MIN_RESIZE_FACTOR 2
+ * @brief A Macro that sets the smallest factor for the table resize process.
+ */
+#define MIN_RESIZE_FACTOR 2
+
+/**
+ * @def ENGINE_LOAD_FACTOR 0
+ * @brief A Macro that sets the max load factor option which selects the default load factor.
+ */
+#define ENGINE_LOAD_FACTOR 0
+
+/**
+ * @def CHAINED_MAX_LOAD 1
+ * @brief A Macro that sets the default max number of nodes per cell of the table.
+ */
+#define CHAINED_MAX_LOAD 1
+
+/**
+ * @def NO_ELEMENTS 0
+ * @brief A Macro that sets the number for no elements in the Concurrent Hash Table.
+ */
+#define NO_ELEMENTS 0
+
+/**
+ * @def LOCK_SUCCESS 0
+ * @brief A Macro that sets the value which the lock functions return on success.
+ */
+#define LOCK_SUCCESS 0
+
+/**
+ * @def CACHE_LINE_SIZE 64
+ * @brief A Macro that sets the size of a cache line, which separates the Readers.
+ */
+#define CACHE_LINE_SIZE 64
+
+/**
+ * @def QUIESCENT_EPOCH 0
+ * @brief A Macro that sets the epoch of a Reader which is not searching. The epochs of the
+ *        table start after it.
+ */
+#define QUIESCENT_EPOCH 0
+
+/**
+ * @def INITIAL_EPOCH 1
+ * @brief A Macro that sets the epoch of a new Concurrent Hash Table.
+ */
+#define INITIAL_EPOCH 1
+
+/**
+ * @def READER_FREE 0
+ * @brief A Macro that sets the state of a Reader which no thread registered.
+ */
+#define READER_FREE 0
+
+/**
+ * @def READER_TAKEN 1
+ * @brief A Macro that sets the state of a Reader which a thread registered.
+ */
+#define READER_TAKEN 1
+
+/**
+ * @def FULL_HASH_RANGE INT_MAX
+ * @brief A Macro that sets the table size which is given to the Hash function in order to
+ *        get a Hash Code that is not reduced to the actual size of the table.
+ */
+#define FULL_HASH_RANGE ((size_t)INT_MAX)
+
+/**
+ * @def CELL_PRINT "[%zu]"
+ * @brief A Macro that sets the output format of printing a cell.
+ */
+#define CELL_PRINT "[%zu]"
+
+/**
+ * @def END_OF_CELL_PRINT "\t\n"
+ * @brief A Macro that sets the output format of the end of a cell.
+ */
+#define END_OF_CELL_PRINT "\t\n"
+
+/**
+ * @def PREFIX_ELEMENT_PRINT "\t"
+ * @brief A Macro that sets the output format of the start of a node.
+ */
+#define PREFIX_ELEMENT_PRINT "\t"
+
+/**
+ * @def SUFFIX_ELEMENT_PRINT "\t-->"
+ * @brief A Macro that sets the output format of the end of a node.
+ */
+#define SUFFIX_ELEMENT_PRINT "\t-->"
+
+/**
+ * @def SEPARATOR_PRINT ","
+ * @brief A Macro that sets the output format of the separator between a key and it's data.
+ */
+#define SEPARATOR_PRINT ","
+
+
+/*-----=  Structs  =-----*/
+
+
+/**
+ * @brief A Structure representing a single node of a chain. The key, data and Hash Code of a
+ *        node are set before it is published. Afterwards only it's data is stored again, and
+ *        the next node of it is changed when the node after it is unlinked.
+ *        A retired node is chained by retiredNext, with the epoch in which it was retired.
+ *        A node which was copied into a grown cells array does not own it's key anymore.
+ */
+typedef struct Node
+{
+    struct Node *next;
+    KeyP key;
+    DataP data;
+    uint64_t hashCode;
+    struct Node *retiredNext;
+    uint64_t retiredEpoch;
+    bool ownsKey;
+} Node;
+
+/**
+ * NodeP is a pointer for a Node.
+ */
+typedef struct Node *NodeP;
+
+/**
+ * @brief A Structure representing the cells array of the table, with the first node of each
+ *        cell. The array is published at once when the table grows, and the array it replaced
+ *        is retired.
+ */
+typedef struct Cells
+{
+    size_t size;
+    struct Cells *retiredNext;
+    uint64_t retiredEpoch;
+    NodeP heads[];
+} Cells;
+
+/**
+ * CellsP is a pointer for a Cells array.
+ */
+typedef struct Cells *CellsP;
+
+/**
+ * @brief A Structure representing the Reader of a single thread. The epoch is the epoch of the
+ *        table when the current search started, or QUIESCENT_EPOCH between searches.
+ *        The Readers are padded, so the epochs of two Readers never share a cache line.
+ */
+typedef struct Reader
+{
+    uint64_t epoch;
+    int state;
+    char padding[CACHE_LINE_SIZE];
+} Reader;
+
+/**
+ * @brief A Structure representing the Concurrent Hash Table.
+ *        The fields every search reads are kept apart from the epoch, which each write
+ *        advances, and from the fields only the writers use, so a write does not evict them
+ *        from the caches of the readers.
+ */
+typedef struct ConcurrentTable
+{
+    // Search Fields.
+    CellsP cells;
+    HashFcn hfun;
+    HashFcn64 hfun64;
+    ComparisonFcn fcomp;
+    char searchPadding[CACHE_LINE_SIZE];
+
+    uint64_t epoch;
+    char epochPadding[CACHE_LINE_SIZE];
+
+    // Writer Fields.
+    pthread_mutex_t writeLock;
+    Reader *readers;
+    size_t maxReaders;
+    MemoryPoolP nodePool;
+    size_t numberOfElements;
+    double maxLoadFactor;
+    size_t growthFactor;
+    NodeP retiredNodes;
+    CellsP retiredCells;
+    CloneKeyFcn cloneKey;
+    FreeKeyFcn freeKey;
+    PrintKeyFcn printKeyFun;
+    PrintDataFcn printDataFun;
+} ConcurrentTable;
+
+
+/*-----=  Hash Functions  =-----*/
+
+
+/**
+ * @brief Generates the full Hash Code of the given key, which is the 64 bit Hash Code if the
+ *        table has a 64 bit Hash function.
+ * @param table A pointer for the Concurrent Hash Table.
+ * @param key The key.
+ * @param hashCode A pointer to update with the full Hash Code.
+ * @return true if the Hash function succeed, false otherwise.
+ */
+static inline bool generateHashCode(const ConcurrentTableP table, const void *key,
+                                    uint64_t *hashCode)
+{
+    assert(table != NULL && key != NULL && hashCode != NULL);
+
+    if ((table -> hfun64) != NULL)
+    {
+        *hashCode = (table -> hfun64)(key);
+        return true;
+    }
+
+    int fullHashCode = (table -> hfun)(key, FULL_HASH_RANGE);
+    if (fullHashCode < HASH_CODE_LOWER_BOUND)
+    {
+        return false;
+    }
+    *hashCode = (uint64_t)fullHashCode;
+    return true;
+}
+
+
+/*-----=  Reclamation Functions  =-----*/
+
+
+/**
+ * @brief Allocate a cells array of the given size with empty cells.
+ * @param size The number of cells.
+ * @return A pointer to the cells array, or NULL if out of memory.
+ */
+static CellsP createCells(size_t size)
+{
+    if (size > (SIZE_MAX - sizeof(Cells)) / sizeof(NodeP))
+    {
+        return NULL;
+    }
+
+    CellsP cells = (CellsP)calloc(1, sizeof(Cells) + size * sizeof(NodeP));
+    if (cells != NULL)
+    {
+        cells -> size = size;
+    }
+    return cells;
+}
+
+/**
+ * @brief Free the given node, with it's key if it owns it. Only a writer frees a node.
+ * @param table A pointer for the Concurrent Hash Table.
+ * @param node A pointer to the node.
+ */
+static void freeNode(ConcurrentTableP table, NodeP node)
+{
+    assert(table != NULL && node != NULL);
+
+    if (node -> ownsKey)
+    {
+        (table -> freeKey)(node -> key);
+    }
+    poolRelease(table -> nodePool, node);
+}
+
+/**
+ * @brief Retire the given unlinked node in the current epoch of the table.
+ * @param table A pointer for the Concurrent Hash Table.
+ * @param node A pointer to the node.
+ */
+static void retireNode(ConcurrentTableP table, NodeP node)
+{
+    assert(table != NULL && node != NULL);
+
+    node -> retiredEpoch = table -> epoch;
+    node -> retiredNext = table -> retiredNodes;
+    table -> retiredNodes = node;
+}
+
+/**
+ * @brief Returns the oldest epoch in which a Reader is still searching, i.e. the oldest epoch
+ *        whose retired memory a Reader may still reach.
+ *        The epoch of the table must be advanced past the retired memory before, so a Reader
+ *        which starts searching afterwards can not find it.
+ * @param table A pointer for the Concurrent Hash Table.
+ * @return The oldest epoch of a searching Reader, or UINT64_MAX if none is searching.
+ */
+static uint64_t getOldestReaderEpoch(const ConcurrentTableP table)
+{
+    assert(table != NULL);
+
+    uint64_t oldestEpoch = UINT64_MAX;
+    for (size_t i = INITIAL_INDEX; i < (table -> maxReaders); i++)
+    {
+        uint64_t readerEpoch = __atomic_load_n(&((table -> readers)[i].epoch), __ATOMIC_SEQ_CST);
+        if (readerEpoch != QUIESCENT_EPOCH && readerEpoch < oldestEpoch)
+        {
+            oldestEpoch = readerEpoch;
+        }
+    }
+    return oldestEpoch;
+}
+
+/**
+ * @brief Advance the epoch of the table past the memory retired so far, and free every
+ *        retired node and cells array that was retired before the oldest searching Reader
+ *        started, as no Reader can reach it anymore. Called by a writer under the write lock.
+ * @param table A pointer for the Concurrent Hash Table.
+ */
+static void reclaimRetired(ConcurrentTableP table)
+{
+    assert(table != NULL);
+
+    if ((table -> retiredNodes) == NULL && (table -> retiredCells) == NULL)
+    {
+        return;
+    }
+
+    // The unlinking stores come before the advance, and the advance before reading the Readers.
+    __atomic_add_fetch(&(table -> epoch), 1, __ATOMIC_SEQ_CST);
+    uint64_t oldestEpoch = getOldestReaderEpoch(table);
+
+    NodeP *pNodeLink = &(table -> retiredNodes);
+    while (*pNodeLink != NULL)
+    {
+        NodeP node = *pNodeLink;
+        if ((node -> retiredEpoch) < oldestEpoch)
+        {
+            *pNodeLink = node -> retiredNext;
+            freeNode(table, node);
+        }
+        else
+        {
+            pNodeLink = &(node -> retiredNext);
+        }
+    }
+
+    CellsP *pCellsLink = &(table -> retiredCells);
+    while (*pCellsLink != NULL)
+    {
+        CellsP cells = *pCellsLink;
+        if ((cells -> retiredEpoch) < oldestEpoch)
+        {
+            *pCellsLink = cells -> retiredNext;
+            free(cells);
+        }
+        else
+        {
+            pCellsLink = &(cells -> retiredNext);
+        }
+    }
+}
+
+
+/*-----=  Concurrent Table Functions  =-----*/
+
+
+/**
+ * @brief Grow the table by it's Growth Factor. Every node is copied into a new cells array, so
+ *        the chains a Reader walks are never relinked, and the new array is published at once.
+ *        The old array and nodes are retired, and the keys move to the copies.
+ *        Called by a writer under the write lock.
+ * @param table A pointer for the Concurrent Hash Table.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool growTable(ConcurrentTableP table)
+{
+    assert(table != NULL);
+
+    CellsP oldCells = table -> cells;
+    if ((oldCells -> size) > SIZE_MAX / (table -> growthFactor))
+    {
+        return false;
+    }
+    CellsP newCells = createCells((oldCells -> size) * (table -> growthFactor));
+    if (newCells == NULL)
+    {
+        return false;
+    }
+
+    for (size_t i = INITIAL_INDEX; i < (oldCells -> size); i++)
+    {
+        for (NodeP node = (oldCells -> heads)[i]; node != NULL; node = node -> next)
+        {
+            NodeP copy = (NodeP)poolAllocate(table -> nodePool);
+            if (copy == NULL)
+            {
+                // The copies do not own their keys yet, so only their memory is released.
+                for (size_t j = INITIAL_INDEX; j < (newCells -> size); j++)
+                {
+                    while ((newCells -> heads)[j] != NULL)
+                    {
+                        NodeP unused = (newCells -> heads)[j];
+                        (newCells -> heads)[j] = unused -> next;
+                        poolRelease(table -> nodePool, unused);
+                    }
+                }
+                free(newCells);
+                return false;
+            }
+            size_t newCell = reduceHashCode(node -> hashCode, newCells -> size);
+            copy -> key = node -> key;
+            copy -> data = node -> data;
+            copy -> hashCode = node -> hashCode;
+            copy -> ownsKey = true;
+            copy -> next = (newCells -> heads)[newCell];
+            (newCells -> heads)[newCell] = copy;
+        }
+    }
+
+    __atomic_store_n(&(table -> cells), newCells, __ATOMIC_RELEASE);
+
+    for (size_t i = INITIAL_INDEX; i < (oldCells -> size); i++)
+    {
+        for (NodeP node = (oldCells -> heads)[i]; node != NULL; node = node -> next)
+        {
+            node -> ownsKey = false;
+            retireNode(table, node);
+        }
+    }
+    oldCells -> retiredEpoch = table -> epoch;
+    oldCells -> retiredNext = table -> retiredCells;
+    table -> retiredCells = oldCells;
+    return true;
+}
+
+/**
+ * @brief Allocate memory for a Concurrent Hash Table with the given number of cells, which up
+ *        to maxReaders threads search at once.
+ *        The table is a chained table which always rehashes when it grows. Of the options it
+ *        uses hfun64, maxLoadFactor, growthFactor and expectedElements. The cell of a key is
+ *        hfun64(key), or hfun(key, INT_MAX) if it is not set, mixed and scaled to the table size.
+ *        The Hash and Comparison functions must be safe to call from several threads at once.
+ *        If the options are invalid report GENERAL_ERROR and return NULL.
+ *        If run out of memory, free all the memory that was already allocated by the function,
+ *        report error MEM_OUT to the standard error and return NULL.
+ * @param tableSize The number of cells in the table.
+ * @param maxReaders The max number of Readers registered at once, at least 1.
+ * @param options A pointer for the options of the table.
+ * @param cloneKey A pointer for the Key Cloning function.
+ * @param freeKey A pointer for the Free Key function.
+ * @param hfun A pointer for the Hash function, may be NULL if the options hold a 64 bit one.
+ * @param printKeyFun A pointer for the Print Key function.
+ * @param printDataFun A pointer for the Print Data function.
+ * @param fcomp A pointer for the Key Comparison function.
+ * @return A pointer for the new Concurrent Hash Table, or NULL if the process failed.
+ */
+ConcurrentTableP createConcurrentTable(size_t tableSize, size_t maxReaders,
+                                       const TableOptions *options, CloneKeyFcn cloneKey,
+                                       FreeKeyFcn freeKey, HashFcn hfun, PrintKeyFcn printKeyFun,
+                                       PrintDataFcn printDataFun, ComparisonFcn fcomp)
+{
+    if (tableSize < MINIMAL_TABLE_SIZE || maxReaders < MINIMAL_NUMBER_OF_READERS
+        || options == NULL || (hfun == NULL && (options -> hfun64) == NULL)
+        || !((options -> maxLoadFactor) >= ENGINE_LOAD_FACTOR)
+        || (options -> growthFactor) < MIN_RESIZE_FACTOR)
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    double maxLoadFactor = (options -> maxLoadFactor) != ENGINE_LOAD_FACTOR ?
+                           options -> maxLoadFactor : CHAINED_MAX_LOAD;
+    while ((double)(options -> expectedElements) > maxLoadFactor * tableSize
+           && tableSize <= SIZE_MAX / (options -> growthFactor))
+    {
+        tableSize *= options -> growthFactor;
+    }
+
+    ConcurrentTableP table = (ConcurrentTableP)malloc(sizeof(ConcurrentTable));
+    if (table == NULL)
+    {
+        reportError(MEM_OUT);
+        return NULL;
+    }
+    table -> cells = createCells(tableSize);
+    table -> readers = (Reader *)calloc(maxReaders, sizeof(Reader));
+    table -> nodePool = createMemoryPool(sizeof(Node), NULL, NULL, NULL);
+    if ((table -> cells) == NULL || (table -> readers) == NULL || (table -> nodePool) == NULL
+        || pthread_mutex_init(&(table -> writeLock), NULL) != LOCK_SUCCESS)
+    {
+        if ((table -> nodePool) != NULL)
+        {
+            freeMemoryPool(table -> nodePool);
+        }
+        free(table -> readers);
+        free(table -> cells);
+        free(table);
+        reportError(MEM_OUT);
+        return NULL;
+    }
+
+    table -> hfun = hfun;
+    table -> hfun64 = options -> hfun64;
+    table -> fcomp = fcomp;
+    table -> epoch = INITIAL_EPOCH;
+    table -> maxReaders = maxReaders;
+    table -> numberOfElements = NO_ELEMENTS;
+    table -> maxLoadFactor = maxLoadFactor;
+    table -> growthFactor = options -> growthFactor;
+    table -> retiredNodes = NULL;
+    table -> retiredCells = NULL;
+    table -> cloneKey = cloneKey;
+    table -> freeKey = freeKey;
+    table -> printKeyFun = printKeyFun;
+    table -> printDataFun = printDataFun;
+    return table;
+}
+
+/**
+ * @brief Register a Reader for the calling thread, which it passes to concurrentFindData.
+ *        A Reader must not be used by two threads at once.
+ *        If maxReaders Readers are already registered, report GENERAL_ERROR and return NULL.
+ * @param table A pointer for the Concurrent Hash Table.
+ * @return A pointer to the Reader, or NULL if the process failed.
+ */
+ReaderP registerReader(ConcurrentTableP table)
+{
+    if (table == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    for (size_t i = INITIAL_INDEX; i < (table -> maxReaders); i++)
+    {
+        int expected = READER_FREE;
+        if (__atomic_compare_exchange_n(&((table -> readers)[i].state), &expected, READER_TAKEN,
+                                        false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            return &((table -> readers)[i]);
+        }
+    }
+    reportError(GENERAL_ERROR);
+    return NULL;
+}
+
+/**
+ * @brief Release the given Reader, so another thread may register it.
+ * @param table A pointer for the Concurrent Hash Table.
+ * @param reader A pointer to the Reader, which is not searching.
+ */
+void unregisterReader(ConcurrentTableP table, ReaderP reader)
+{
+    if (table == NULL || reader == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return;
+    }
+
+    __atomic_store_n(&(reader -> state), READER_FREE, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Search the table for the object of the given key without taking any lock, while
+ *        writers keep changing the table. The search sees the table either before or after
+ *        each write.
+ *        The Reader enters the current epoch before it reads the cells, so a writer which
+ *        retires a node the search may reach keeps it until the Reader leaves the epoch.
+ * @param table A pointer for the Concurrent Hash Table to search in.
+ * @param reader A pointer to the Reader of the calling thread.
+ * @param key The key to search.
+ * @return A pointer to the data if found, otherwise return NULL.
+ */
+DataP concurrentFindData(const ConcurrentTableP table, ReaderP reader, const void *key)
+{
+    if (table == NULL || reader == NULL || key == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    uint64_t hashCode = 0;
+    if (!generateHashCode(table, key, &hashCode))
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    // The fence orders the entered epoch before the reads of the cells, as the writer orders
+    // advancing the epoch before reading the epochs of the Readers.
+    __atomic_store_n(&(reader -> epoch), __atomic_load_n(&(table -> epoch), __ATOMIC_ACQUIRE),
+                     __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    DataP foundData = NULL;
+    CellsP cells = __atomic_load_n(&(table -> cells), __ATOMIC_ACQUIRE);
+    size_t cell = reduceHashCode(hashCode, cells -> size);
+    NodeP node = __atomic_load_n(&((cells -> heads)[cell]), __ATOMIC_ACQUIRE);
+    while (node != NULL)
+    {
+        if ((node -> hashCode) == hashCode && (table -> fcomp)(node -> key, key) == 0)
+        {
+            foundData = __atomic_load_n(&(node -> data), __ATOMIC_ACQUIRE);
+            break;
+        }
+        node = __atomic_load_n(&(node -> next), __ATOMIC_ACQUIRE);
+    }
+
+    __atomic_store_n(&(reader -> epoch), QUIESCENT_EPOCH, __ATOMIC_RELEASE);
+    return foundData;
+}
+
+/**
+ * @brief Insert an object to the table with key, or replace the object of the key if it is
+ *        already in the table, under the lock of the writers.
+ *        A new node is linked at the head of it's cell, and published by a release store only
+ *        after it is filled, so a Reader never sees a partial node.
+ * @param table A pointer for the Concurrent Hash Table to insert to.
+ * @param key The key to insert.
+ * @param object The object that is stored by the given key.
+ * @param previous A pointer to update with the replaced object, or NULL.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int concurrentUpsert(ConcurrentTableP table, const void *key, DataP object, DataP *previous)
+{
+    if (table == NULL || key == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return false;
+    }
+
+    uint64_t hashCode = 0;
+    if (!generateHashCode(table, key, &hashCode))
+    {
+        reportError(GENERAL_ERROR);
+        return false;
+    }
+
+    pthread_mutex_lock(&(table -> writeLock));
+    CellsP cells = table -> cells;
+    size_t cell = reduceHashCode(hashCode, cells -> size);
+    for (NodeP node = (cells -> heads)[cell]; node != NULL; node = node -> next)
+    {
+        if ((node -> hashCode) == hashCode && (table -> fcomp)(node -> key, key) == 0)
+        {
+            if (previous != NULL)
+            {
+                *previous = node -> data;
+            }
+            __atomic_store_n(&(node -> data), object, __ATOMIC_RELEASE);
+            pthread_mutex_unlock(&(table -> writeLock));
+            return true;
+        }
+    }
+
+    if ((double)((table -> numberOfElements) + 1) > (table -> maxLoadFactor) * (cells -> size))
+    {
+        // A table which can not grow keeps inserting to longer chains.
+        if (growTable(table))
+        {
+            cells = table -> cells;
+            cell = reduceHashCode(hashCode, cells -> size);
+        }
+    }
+
+    NodeP node = (NodeP)poolAllocate(table -> nodePool);
+    KeyP clonedKey = (node != NULL) ? (table -> cloneKey)(key) : NULL;
+    if (clonedKey == NULL)
+    {
+        poolRelease(table -> nodePool, node);
+        reclaimRetired(table);
+        pthread_mutex_unlock(&(table -> writeLock));
+        reportError(MEM_OUT);
+        return false;
+    }
+    node -> key = clonedKey;
+    node -> data = object;
+    node -> hashCode = hashCode;
+    node -> ownsKey = true;
+    node -> next = (cells -> heads)[cell];
+    __atomic_store_n(&((cells -> heads)[cell]), node, __ATOMIC_RELEASE);
+    (table -> numberOfElements)++;
+    if (previous != NULL)
+    {
+        *previous = NULL;
+    }
+
+    reclaimRetired(table);
+    pthread_mutex_unlock(&(table -> writeLock));
+    return true;
+}
+
+/**
+ * @brief Insert an object to the table with key, as with concurrentUpsert.
+ * @param table A pointer for the Concurrent Hash Table to insert to.
+ * @param key The key to insert.
+ * @param object The object that is stored by the given key.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int concurrentInsert(ConcurrentTableP table, const void *key, DataP object)
+{
+    return concurrentUpsert(table, key, object, NULL);
+}
+
+/**
+ * @brief Remove the object of the given key from the table, under the lock of the writers.
+ *        The node is unlinked by a release store and retired, and a Reader which is on it
+ *        keeps walking the rest of it's chain.
+ * @param table A pointer for the Concurrent Hash Table to remove from.
+ * @param key The key to remove.
+ * @return A pointer for the ejected data, or NULL if the key was not found.
+ */
+DataP concurrentRemoveData(ConcurrentTableP table, const void *key)
+{
+    if (table == NULL || key == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    uint64_t hashCode = 0;
+    if (!generateHashCode(table, key, &hashCode))
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    pthread_mutex_lock(&(table -> writeLock));
+    CellsP cells = table -> cells;
+    NodeP *pLink = &((cells -> heads)[reduceHashCode(hashCode, cells -> size)]);
+    DataP removedData = NULL;
+    while (*pLink != NULL)
+    {
+        NodeP node = *pLink;
+        if ((node -> hashCode) == hashCode && (table -> fcomp)(node -> key, key) == 0)
+        {
+            removedData = node -> data;
+            __atomic_store_n(pLink, node -> next, __ATOMIC_RELEASE);
+            retireNode(table, node);
+            (table -> numberOfElements)--;
+            break;
+        }
+        pLink = &(node -> next);
+    }
+
+    reclaimRetired(table);
+    pthread_mutex_unlock(&(table -> writeLock));
+    return removedData;
+}
+
+/**
+ * @brief Free the memory that writers removed from the table and that no Reader can reach
+ *        anymore. Writers do it by themselves, this only frees it sooner.
+ * @param table A pointer for the Concurrent Hash Table.
+ */
+void concurrentReclaim(ConcurrentTableP table)
+{
+    if (table == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return;
+    }
+
+    pthread_mutex_lock(&(table -> writeLock));
+    reclaimRetired(table);
+    pthread_mutex_unlock(&(table -> writeLock));
+}
+
+/**
+ * @brief Print the table, under the lock of the writers.
+ * @param table A pointer to the Concurrent Hash Table to print.
+ */
+void printConcurrentTable(const ConcurrentTableP table)
+{
+    if (table == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return;
+    }
+
+    pthread_mutex_lock(&(table -> writeLock));
+    CellsP cells = table -> cells;
+    for (size_t i = INITIAL_INDEX; i < (cells -> size); i++)
+    {
+        printf(CELL_PRINT, i);
+        for (NodeP node = (cells -> heads)[i]; node != NULL; node = node -> next)
+        {
+            printf(PREFIX_ELEMENT_PRINT);
+            (table -> printKeyFun)(node -> key);
+            printf(SEPARATOR_PRINT);
+            (table -> printDataFun)(node -> data);
+            printf(SUFFIX_ELEMENT_PRINT);
+        }
+        printf(END_OF_CELL_PRINT);
+    }
+    pthread_mutex_unlock(&(table -> writeLock));
+}
+
+/**
+ * @brief Free all the memory allocated for the Concurrent Hash Table.
+ *        No other thread may use the table during or after the call.
+ * @param table A pointer to the Concurrent Hash Table to free.
+ */
+void freeConcurrentTable(ConcurrentTableP table)
+{
+    if (table == NULL)
+    {
+        return;
+    }
+
+    // The nodes and the retired nodes which still own their keys free them, the rest of
+    // their memory goes with the pool.
+    CellsP cells = table -> cells;
+    for (size_t i = INITIAL_INDEX; i < (cells -> size); i++)
+    {
+        for (NodeP node = (cells -> heads)[i]; node != NULL; node = node -> next)
+        {
+            (table -> freeKey)(node -> key);
+        }
+    }
+    free(cells);
+    for (NodeP node = table -> retiredNodes; node != NULL; node = node -> retiredNext)
+    {
+        if (node -> ownsKey)
+        {
+            (table -> freeKey)(node -> key);
+        }
+    }
+    while ((table -> retiredCells) != NULL)
+    {
+        CellsP retiredCells = table -> retiredCells;
+        table -> retiredCells = retiredCells -> retiredNext;
+        free(retiredCells);
+    }
+
+    freeMemoryPool(table -> nodePool);
+    pthread_mutex_destroy(&(table -> writeLock));
+    free(table -> readers);
+    free(table);
+}
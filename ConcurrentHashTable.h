@@ -0,0 +1,156 @@
+#ifndef _CONCURRENT_HASH_TABLE_H_
+#define _CONCURRENT_HASH_TABLE_H_
+
+/**
+ * @file ConcurrentHashTable.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header file for the Concurrent Hash Table. It declares a chained Hash Table whose
+ *        readers never take a lock, while writers publish their changes to them and free the
+ *        memory the readers may still hold only once no reader can reach it.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header file for the Concurrent Hash Table. It declares a chained Hash Table whose
+ * readers never take a lock, while writers publish their changes to them and free the
+ * memory the readers may still hold only once no reader can reach it.
+ * Input:       No particular input.
+ * Process:     Each reading thread registers once and searches with it's own Reader, which
+ *              records the epoch in which it searches. Writers are serialized by a lock, and
+ *              free a removed node or a replaced cells array only after every Reader that was
+ *              searching when it was removed has finished.
+ * Output:      No particular output.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stddef.h>
+#include "GenericHashTable.h"
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * ConcurrentTableP is a pointer for a Concurrent Hash Table.
+ */
+typedef struct ConcurrentTable *ConcurrentTableP;
+
+/**
+ * ReaderP is a pointer for the Reader of a single reading thread of a Concurrent Hash Table.
+ */
+typedef struct Reader *ReaderP;
+
+
+/*-----=  Forward Declarations  =-----*/
+
+
+/**
+ * @brief Allocate memory for a Concurrent Hash Table with the given number of cells, which up
+ *        to maxReaders threads search at once.
+ *        The table is a chained table which always rehashes when it grows. Of the options it
+ *        uses hfun64, maxLoadFactor, growthFactor and expectedElements. The cell of a key is
+ *        hfun64(key), or hfun(key, INT_MAX) if it is not set, mixed and scaled to the table size.
+ *        The Hash and Comparison functions must be safe to call from several threads at once.
+ *        If the options are invalid report GENERAL_ERROR and return NULL.
+ *        If run out of memory, free all the memory that was already allocated by the function,
+ *        report error MEM_OUT to the standard error and return NULL.
+ * @param tableSize The number of cells in the table.
+ * @param maxReaders The max number of Readers registered at once, at least 1.
+ * @param options A pointer for the options of the table.
+ * @param cloneKey A pointer for the Key Cloning function.
+ * @param freeKey A pointer for the Free Key function.
+ * @param hfun A pointer for the Hash function, may be NULL if the options hold a 64 bit one.
+ * @param printKeyFun A pointer for the Print Key function.
+ * @param printDataFun A pointer for the Print Data function.
+ * @param fcomp A pointer for the Key Comparison function.
+ * @return A pointer for the new Concurrent Hash Table, or NULL if the process failed.
+ */
+ConcurrentTableP createConcurrentTable(size_t tableSize, size_t maxReaders,
+                                       const TableOptions *options, CloneKeyFcn cloneKey,
+                                       FreeKeyFcn freeKey, HashFcn hfun, PrintKeyFcn printKeyFun,
+                                       PrintDataFcn printDataFun, ComparisonFcn fcomp);
+
+/**
+ * @brief Register a Reader for the calling thread, which it passes to concurrentFindData.
+ *        A Reader must not be used by two threads at once.
+ *        If maxReaders Readers are already registered, report GENERAL_ERROR and return NULL.
+ * @param table A pointer for the Concurrent Hash Table.
+ * @return A pointer to the Reader, or NULL if the process failed.
+ */
+ReaderP registerReader(ConcurrentTableP table);
+
+/**
+ * @brief Release the given Reader, so another thread may register it.
+ * @param table A pointer for the Concurrent Hash Table.
+ * @param reader A pointer to the Reader, which is not searching.
+ */
+void unregisterReader(ConcurrentTableP table, ReaderP reader);
+
+/**
+ * @brief Search the table for the object of the given key without taking any lock, while
+ *        writers keep changing the table. The search sees the table either before or after
+ *        each write.
+ * @param table A pointer for the Concurrent Hash Table to search in.
+ * @param reader A pointer to the Reader of the calling thread.
+ * @param key The key to search.
+ * @return A pointer to the data if found, otherwise return NULL.
+ */
+DataP concurrentFindData(const ConcurrentTableP table, ReaderP reader, const void *key);
+
+/**
+ * @brief Insert an object to the table with key, or replace the object of the key if it is
+ *        already in the table, under the lock of the writers.
+ * @param table A pointer for the Concurrent Hash Table to insert to.
+ * @param key The key to insert.
+ * @param object The object that is stored by the given key.
+ * @param previous A pointer to update with the replaced object, or NULL.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int concurrentUpsert(ConcurrentTableP table, const void *key, DataP object, DataP *previous);
+
+/**
+ * @brief Insert an object to the table with key, as with concurrentUpsert.
+ * @param table A pointer for the Concurrent Hash Table to insert to.
+ * @param key The key to insert.
+ * @param object The object that is stored by the given key.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int concurrentInsert(ConcurrentTableP table, const void *key, DataP object);
+
+/**
+ * @brief Remove the object of the given key from the table, under the lock of the writers.
+ *        The memory of the key is freed once no Reader can reach it.
+ * @param table A pointer for the Concurrent Hash Table to remove from.
+ * @param key The key to remove.
+ * @return A pointer for the ejected data, or NULL if the key was not found.
+ */
+DataP concurrentRemoveData(ConcurrentTableP table, const void *key);
+
+/**
+ * @brief Free the memory that writers removed from the table and that no Reader can reach
+ *        anymore. Writers do it by themselves, this only frees it sooner.
+ * @param table A pointer for the Concurrent Hash Table.
+ */
+void concurrentReclaim(ConcurrentTableP table);
+
+/**
+ * @brief Print the table, under the lock of the writers.
+ * @param table A pointer to the Concurrent Hash Table to print.
+ */
+void printConcurrentTable(const ConcurrentTableP table);
+
+/**
+ * @brief Free all the memory allocated for the Concurrent Hash Table.
+ *        No other thread may use the table during or after the call.
+ * @param table A pointer to the Concurrent Hash Table to free.
+ */
+void freeConcurrentTable(ConcurrentTableP table);
+
+#endif // _CONCURRENT_HASH_TABLE_H_
@@ -0,0 +1,210 @@
+/**
+ * @file ConcurrentTableTester.c
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Tester for the Concurrent Hash Table.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Tester for the Concurrent Hash Table.
+ * Input:       No particular input.
+ * Process:     Readers search the table without a lock while a writer keeps inserting and
+ *              removing keys and the table grows, and check that every object they find is the
+ *              object of it's key. Afterwards the table must hold exactly the keys which were
+ *              not removed.
+ * Output:      The result of each check, and EXIT_FAILURE if any of them failed.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "ConcurrentHashTable.h"
+#include "MyIntFunctions.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def NUMBER_OF_READERS 3
+ * @brief A Macro that sets the number of threads which search the table at once.
+ */
+#define NUMBER_OF_READERS 3
+
+/**
+ * @def INITIAL_TABLE_SIZE 4
+ * @brief A Macro that sets the number of cells of the tested table, which is small so the
+ *        table grows while it is searched.
+ */
+#define INITIAL_TABLE_SIZE 4
+
+/**
+ * @def NUMBER_OF_KEYS 2000
+ * @brief A Macro that sets the number of keys the writer inserts in each round.
+ */
+#define NUMBER_OF_KEYS 2000
+
+/**
+ * @def NUMBER_OF_ROUNDS 30
+ * @brief A Macro that sets the number of rounds of inserting and removing keys.
+ */
+#define NUMBER_OF_ROUNDS 30
+
+/**
+ * @def REMOVED_KEY_STEP 2
+ * @brief A Macro that sets the step between the keys the writer removes in each round.
+ */
+#define REMOVED_KEY_STEP 2
+
+/**
+ * @def DATA_FACTOR 10
+ * @brief A Macro that sets the factor between a key and it's object.
+ */
+#define DATA_FACTOR 10
+
+
+/*-----=  Structs  =-----*/
+
+
+/**
+ * @brief A Structure representing the state shared by the writer and the readers.
+ */
+typedef struct ReaderTask
+{
+    ConcurrentTableP table;
+    bool stop;
+    size_t wrongObjects;
+    size_t searches;
+} ReaderTask;
+
+
+/*-----=  Test Functions  =-----*/
+
+
+/**
+ * @brief Searches every key until the writer stops, and counts the found objects which are
+ *        not the object of their key.
+ * @param arg A pointer to the ReaderTask shared by the threads.
+ * @return NULL.
+ */
+static void *runReader(void *arg)
+{
+    ReaderTask *task = (ReaderTask *)arg;
+    ReaderP reader = registerReader(task -> table);
+    if (reader == NULL)
+    {
+        __atomic_add_fetch(&(task -> wrongObjects), 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+
+    size_t searches = 0;
+    while (!__atomic_load_n(&(task -> stop), __ATOMIC_ACQUIRE))
+    {
+        for (int key = 0; key < NUMBER_OF_KEYS; key++)
+        {
+            DataP data = concurrentFindData(task -> table, reader, &key);
+            if (data != NULL && *(int *)data != key * DATA_FACTOR)
+            {
+                __atomic_add_fetch(&(task -> wrongObjects), 1, __ATOMIC_RELAXED);
+            }
+            searches++;
+        }
+    }
+    unregisterReader(task -> table, reader);
+    __atomic_add_fetch(&(task -> searches), searches, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+/**
+ * @brief Runs NUMBER_OF_READERS readers while the writer inserts every key and removes every
+ *        REMOVED_KEY_STEP key of them, NUMBER_OF_ROUNDS times.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testReadersDuringWrites()
+{
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    ConcurrentTableP table = createConcurrentTable(INITIAL_TABLE_SIZE, NUMBER_OF_READERS + 1,
+                                                   &options, cloneInt, freeInt, intFcn, intPrint,
+                                                   intPrint, intCompare);
+    if (table == NULL)
+    {
+        return false;
+    }
+
+    static int objects[NUMBER_OF_KEYS];
+    for (int key = 0; key < NUMBER_OF_KEYS; key++)
+    {
+        objects[key] = key * DATA_FACTOR;
+    }
+
+    ReaderTask task = {table, false, 0, 0};
+    pthread_t threads[NUMBER_OF_READERS];
+    for (size_t i = 0; i < NUMBER_OF_READERS; i++)
+    {
+        pthread_create(&threads[i], NULL, runReader, &task);
+    }
+
+    bool passed = true;
+    for (int round = 0; round < NUMBER_OF_ROUNDS; round++)
+    {
+        for (int key = 0; key < NUMBER_OF_KEYS; key++)
+        {
+            passed = concurrentInsert(table, &key, &objects[key]) && passed;
+        }
+        for (int key = 0; key < NUMBER_OF_KEYS; key += REMOVED_KEY_STEP)
+        {
+            passed = concurrentRemoveData(table, &key) == &objects[key] && passed;
+        }
+    }
+
+    __atomic_store_n(&(task.stop), true, __ATOMIC_RELEASE);
+    for (size_t i = 0; i < NUMBER_OF_READERS; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    printf("The readers made %zu searches\n", task.searches);
+    passed = passed && task.wrongObjects == 0;
+
+    ReaderP reader = registerReader(table);
+    for (int key = 0; passed && key < NUMBER_OF_KEYS; key++)
+    {
+        DataP expected = (key % REMOVED_KEY_STEP == 0) ? NULL : &objects[key];
+        passed = concurrentFindData(table, reader, &key) == expected;
+    }
+    unregisterReader(table, reader);
+    freeConcurrentTable(table);
+    return passed;
+}
+
+/**
+ * @brief Prints the result of the given check.
+ * @param name The name of the check.
+ * @param passed Whether the check passed.
+ * @return passed.
+ */
+static bool reportTest(const char *name, bool passed)
+{
+    printf("%s: %s\n", name, passed ? "passed" : "FAILED");
+    return passed;
+}
+
+/**
+ * @brief The main function. Runs the checks of the Concurrent Hash Table.
+ * @return EXIT_SUCCESS if all the checks passed, EXIT_FAILURE otherwise.
+ */
+int main()
+{
+    bool passed = true;
+    passed &= reportTest("Readers during writes", testReadersDuringWrites());
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -30,9 +30,15 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
 #include <assert.h>
+#include <pthread.h>
 #include "TableErrorHandle.h"
 #include "GenericHashTable.h"
+#include "HashReduction.h"
 
 
 /*-----=  Definitions  =-----*/
@@ -50,6 +56,12 @@
  */
 #define INVALID_INDEX -1
 
+/**
+ * @def NO_POSITION SIZE_MAX
+ * @brief A Macro that sets the position of a cell, a node or a Slot that does not exist.
+ */
+#define NO_POSITION SIZE_MAX
+
 /**
  * @def MINIMAL_TABLE_SIZE 1
  * @brief A Macro that sets the minimal size of a Hash Table.
@@ -64,29 +76,341 @@
 
 /**
  * @def RESIZE_FACTOR 2
- * @brief A Macro that sets the factor for the table resize process.
+ * @brief A Macro that sets the default factor for the table resize process.
  */
 #define RESIZE_FACTOR 2
 
+/**
+ * @def MIN_RESIZE_FACTOR 2
+ * @brief A Macro that sets the smallest factor for the table resize process.
+ */
+#define MIN_RESIZE_FACTOR 2
+
+/**
+ * @def ENGINE_LOAD_FACTOR 0
+ * @brief A Macro that sets the max load factor option which selects the default of the engine.
+ */
+#define ENGINE_LOAD_FACTOR 0
+
+/**
+ * @def NO_SHRINK 0
+ * @brief A Macro that sets the min load factor of a Hash Table which never shrinks.
+ */
+#define NO_SHRINK 0
+
+/**
+ * @def NO_SHRINK_LIMIT SIZE_MAX
+ * @brief A Macro that sets the shrink limit of a Hash Table whose last shrink did not fail.
+ */
+#define NO_SHRINK_LIMIT SIZE_MAX
+
 /**
  * @def NO_ELEMENTS 0
  * @brief A Macro that sets the number for no elements in the Hash Table.
  */
 #define NO_ELEMENTS 0
 
+/**
+ * @def CHAINED_MAX_LOAD 1
+ * @brief A Macro that sets the default max number of Elements per cell of a rehashed Hash Table.
+ *        Below it a full Bucket is chained past its capacity instead of resizing the Table,
+ *        which keeps keys that no table size can separate from growing the Table endlessly.
+ */
+#define CHAINED_MAX_LOAD 1
+
+/**
+ * @def INCREMENTAL_MIGRATION_STEP 4
+ * @brief A Macro that sets the number of old cells that each operation on an incrementally
+ *        growing Hash Table moves into the grown Table.
+ */
+#define INCREMENTAL_MIGRATION_STEP 4
+
+/**
+ * @def FULL_HASH_RANGE INT_MAX
+ * @brief A Macro that sets the table size which is given to the Hash function in order to
+ *        get a Hash Code that is not reduced to the actual size of the Hash Table.
+ */
+#define FULL_HASH_RANGE ((size_t)INT_MAX)
+
+/**
+ * @def FLOOD_CHAIN_LENGTH 32
+ * @brief A Macro that sets the default number of objects searched by an insert at which a chained
+ *        Hash Table with a seeded Hash function switches to it.
+ */
+#define FLOOD_CHAIN_LENGTH 32
+
+/**
+ * @def SERIAL_RESIZE 1
+ * @brief A Macro that sets the number of resize threads of a Hash Table which rehashes it's
+ *        cells on the calling thread alone.
+ */
+#define SERIAL_RESIZE 1
+
+/**
+ * @def MIN_CELLS_PER_RESIZE_THREAD 16384
+ * @brief A Macro that sets the smallest number of cells rehashed by each thread of a parallel
+ *        resize, so small Tables do not pay for starting threads.
+ */
+#define MIN_CELLS_PER_RESIZE_THREAD 16384
+
+/**
+ * @def MIN_KEYS_PER_BUILD_THREAD 16384
+ * @brief A Macro that sets the smallest number of keys inserted by each thread of a parallel
+ *        build, so small builds do not pay for starting threads.
+ */
+#define MIN_KEYS_PER_BUILD_THREAD 16384
+
+/**
+ * @def THREAD_SUCCESS 0
+ * @brief A Macro that sets the value which pthread_create returns on success.
+ */
+#define THREAD_SUCCESS 0
+
+/**
+ * @def SEEDED_FROM_START 0
+ * @brief A Macro that sets the flood chain length of a Hash Table which uses it's seeded Hash
+ *        function from the start.
+ */
+#define SEEDED_FROM_START 0
+
+/**
+ * @def RANDOM_SOURCE "/dev/urandom"
+ * @brief A Macro that sets the file from which the random seed of a Hash Table is read.
+ */
+#define RANDOM_SOURCE "/dev/urandom"
+
+/**
+ * @def SEED_INCREMENT 0x9E3779B97F4A7C15
+ * @brief A Macro that sets the step of the generator of a seed without a random source.
+ */
+#define SEED_INCREMENT UINT64_C(0x9E3779B97F4A7C15)
+
+/**
+ * @def SEED_MULTIPLIER_1 0xBF58476D1CE4E5B9
+ * @brief A Macro that sets the first multiplier of the generator of a seed.
+ */
+#define SEED_MULTIPLIER_1 UINT64_C(0xBF58476D1CE4E5B9)
+
+/**
+ * @def SEED_MULTIPLIER_2 0x94D049BB133111EB
+ * @brief A Macro that sets the second multiplier of the generator of a seed.
+ */
+#define SEED_MULTIPLIER_2 UINT64_C(0x94D049BB133111EB)
+
+/**
+ * @def SEED_SHIFT_1 30
+ * @brief A Macro that sets the first shift of the generator of a seed.
+ */
+#define SEED_SHIFT_1 30
+
+/**
+ * @def SEED_SHIFT_2 27
+ * @brief A Macro that sets the second shift of the generator of a seed.
+ */
+#define SEED_SHIFT_2 27
+
+/**
+ * @def SEED_SHIFT_3 31
+ * @brief A Macro that sets the third shift of the generator of a seed.
+ */
+#define SEED_SHIFT_3 31
+
+/**
+ * @def ROBIN_HOOD_MAX_LOAD 0.9
+ * @brief A Macro that sets the default max ratio of used slots in a Robin Hood Hash Table.
+ */
+#define ROBIN_HOOD_MAX_LOAD 0.9
+
+/**
+ * @def FULL_LOAD 1
+ * @brief A Macro that sets the ratio of used slots in a full Robin Hood Hash Table.
+ */
+#define FULL_LOAD 1
+
+/**
+ * @def NO_INLINE_KEY 0
+ * @brief A Macro that sets the inline key size of a Hash Table which clones all of it's keys.
+ */
+#define NO_INLINE_KEY 0
+
+/**
+ * @def CARRIED_SLOT 0
+ * @brief A Macro that sets the index of the spare Slot which holds the Slot that is being placed.
+ */
+#define CARRIED_SLOT 0
+
+/**
+ * @def SWAPPED_SLOT 1
+ * @brief A Macro that sets the index of the spare Slot used while swapping two Slots.
+ */
+#define SWAPPED_SLOT 1
+
+/**
+ * @def NUMBER_OF_SPARE_SLOTS 2
+ * @brief A Macro that sets the number of spare Slots of a Robin Hood Hash Table.
+ */
+#define NUMBER_OF_SPARE_SLOTS 2
+
+/**
+ * @def SINGLE_SLOT_NODE 0
+ * @brief A Macro that sets the placement reported for objects of a Robin Hood Hash Table,
+ *        where each cell holds a single slot.
+ */
+#define SINGLE_SLOT_NODE 0
+
+/**
+ * @def CUCKOO_BUCKET_SLOTS 4
+ * @brief A Macro that sets the number of Slots in each Bucket of a cuckoo Hash Table.
+ */
+#define CUCKOO_BUCKET_SLOTS 4
+
+/**
+ * @def CUCKOO_STASH_BUCKETS 1
+ * @brief A Macro that sets the number of Buckets in the stash of a cuckoo Hash Table, which
+ *        follow it's last Bucket.
+ */
+#define CUCKOO_STASH_BUCKETS 1
+
+/**
+ * @def CUCKOO_MAX_SEARCH 256
+ * @brief A Macro that sets the max number of Buckets visited while searching for a chain of
+ *        displacements which frees a Slot for a new key in a cuckoo Hash Table.
+ */
+#define CUCKOO_MAX_SEARCH 256
+
+/**
+ * @def CUCKOO_MAX_GROWTHS 4
+ * @brief A Macro that sets the number of times a cuckoo Hash Table which could not place a new
+ *        object tries a larger size, before it gives up.
+ */
+#define CUCKOO_MAX_GROWTHS 4
+
+/**
+ * @def CUCKOO_MAX_SHARED_HASH 12
+ * @brief A Macro that sets the number of keys with a single full Hash Code a cuckoo Hash Table
+ *        can hold, i.e. the Slots of their two Buckets and of the stash.
+ */
+#define CUCKOO_MAX_SHARED_HASH ((2 + CUCKOO_STASH_BUCKETS) * CUCKOO_BUCKET_SLOTS)
+
+/**
+ * @def CUCKOO_MAX_LOAD 3.8
+ * @brief A Macro that sets the default max load factor of a cuckoo Hash Table, i.e. 95% of the
+ *        Slots of a Bucket, which reserveTable and compactTable size the Table for.
+ */
+#define CUCKOO_MAX_LOAD 3.8
+
+/**
+ * @def CUCKOO_HASH_MULTIPLIER 0xC2B2AE3D27D4EB4F
+ * @brief A Macro that sets the multiplier which mixes a full Hash Code into the second Bucket
+ *        of it's key in a cuckoo Hash Table.
+ */
+#define CUCKOO_HASH_MULTIPLIER UINT64_C(0xC2B2AE3D27D4EB4F)
+
+/**
+ * @def CUCKOO_HASH_SHIFT 32
+ * @brief A Macro that sets the shift of the mixed Hash Code to the bits which give the second
+ *        Bucket of a key in a cuckoo Hash Table.
+ */
+#define CUCKOO_HASH_SHIFT 32
+
+/**
+ * @def NO_PARENT_NODE -1
+ * @brief A Macro that sets the parent of the first nodes of a cuckoo displacement search.
+ */
+#define NO_PARENT_NODE -1
+
 #ifndef MAX_ROW_ELEMENTS
 /**
  * @def MAX_ROW_ELEMENTS 2
- * @brief A Macro that sets the max number of elements in a single cell in the Hash Table.
+ * @brief A Macro that sets the default max number of elements in a single cell in the Hash Table.
  */
 #define MAX_ROW_ELEMENTS 2
 #endif
 
 /**
- * @def CELL_PRINT "[%d]"
+ * @def BUCKET_TAGS 8
+ * @brief A Macro that sets the number of Elements at the head of a Bucket which have a tag.
+ */
+#define BUCKET_TAGS 8
+
+/**
+ * @def TAG_BITS 8
+ * @brief A Macro that sets the number of bits of a single tag.
+ */
+#define TAG_BITS 8
+
+/**
+ * @def TAG_MASK 0xFF
+ * @brief A Macro that sets the mask of a single tag in the tags of a Bucket.
+ */
+#define TAG_MASK 0xFFu
+
+/**
+ * @def TAG_MULTIPLIER 0x9E3779B97F4A7C15
+ * @brief A Macro that sets the multiplier which mixes the bits of a Hash Code into it's tag.
+ */
+#define TAG_MULTIPLIER UINT64_C(0x9E3779B97F4A7C15)
+
+/**
+ * @def TAG_SHIFT 56
+ * @brief A Macro that sets the shift of the mixed Hash Code to it's top bits, which are the tag.
+ */
+#define TAG_SHIFT 56
+
+/**
+ * @def TAG_LOW_BYTES 0x0101010101010101
+ * @brief A Macro that sets the lowest bit of each tag in the tags of a Bucket.
+ */
+#define TAG_LOW_BYTES UINT64_C(0x0101010101010101)
+
+/**
+ * @def TAG_LOW_BITS 0x7F7F7F7F7F7F7F7F
+ * @brief A Macro that sets all the bits but the highest one of each tag in the tags of a Bucket.
+ */
+#define TAG_LOW_BITS UINT64_C(0x7F7F7F7F7F7F7F7F)
+
+/**
+ * @def TAG_GATHER_MULTIPLIER 0x0102040810204080
+ * @brief A Macro that sets the multiplier which gathers one bit of each tag into the top byte.
+ */
+#define TAG_GATHER_MULTIPLIER UINT64_C(0x0102040810204080)
+
+/**
+ * @def NO_TAG_MATCHES 0
+ * @brief A Macro that sets the matches of a tag which is not in a Bucket.
+ */
+#define NO_TAG_MATCHES 0u
+
+/**
+ * @def FIRST_TAG_MATCH 1
+ * @brief A Macro that sets the match bit of the first tag in the matches of a tag.
+ */
+#define FIRST_TAG_MATCH 1u
+
+/**
+ * @def BATCH_GROUP_SIZE 16
+ * @brief A Macro that sets the number of keys of a batch whose cells are loaded together.
+ */
+#define BATCH_GROUP_SIZE 16
+
+/**
+ * @def PREFETCH(address)
+ * @brief A Macro that hints the processor to load the given address into the cache, without
+ *        waiting for it. Compilers without such a hint ignore it.
+ */
+#ifndef PREFETCH
+#ifdef __GNUC__
+#define PREFETCH(address) __builtin_prefetch(address)
+#else
+#define PREFETCH(address) ((void)(address))
+#endif
+#endif
+
+/**
+ * @def CELL_PRINT "[%zu]"
  * @brief A Macro that sets the output format of printing a cell while calling the print function.
  */
-#define CELL_PRINT "[%d]"
+#define CELL_PRINT "[%zu]"
 
 /**
  * @def END_OF_CELL_PRINT "\t\n"
@@ -126,334 +450,700 @@ typedef struct Bucket *BucketP;
  */
 typedef struct Element *ElementP;
 
+/**
+ * SlotP is a pointer for a Slot in a Robin Hood or a cuckoo Hash Table.
+ */
+typedef struct Slot *SlotP;
+
+/**
+ * HashCode is a Hash Code of a key which is not reduced to the size of the Hash Table.
+ */
+typedef uint64_t HashCode;
+
+/**
+ * BucketTags holds the tags of the first Elements of a Bucket, one byte for each Element.
+ */
+typedef uint64_t BucketTags;
+
 
 /*-----=  Structs  =-----*/
 
 
+/**
+ * @brief A union of the types with the strictest alignment, used as the storage unit of keys
+ *        which are held inline, so any fixed size key can be read in place.
+ */
+typedef union KeyStorage
+{
+    void *pointer;
+    long long integer;
+    double floating;
+} KeyStorage;
+
 /**
  * @brief A Structure representing a single Element in the Bucket.
- *        An Element contains it's key and it's data.
+ *        An Element contains it's key, it's data and the full Hash Code of it's key, which is
+ *        compared before the keys themselves and places the Element when the Table grows.
  *        The Element holds a pointer to the next Element associated to him.
+ *        A small key is stored inline right after the Element, and the key points to it.
  */
 typedef struct Element
 {
     KeyP key;
     DataP data;
     ElementP next;
+    HashCode hashCode;
+    KeyStorage inlineKey[];
 } Element;
 
 /**
  * @brief A Structure representing the Bucket, which is a Linked List of Elements.
- *        Each Bucket holds its size, which is it's capacity, and the current
- *        number of Elements in the Bucket. Also it holds a pointer to the head of
- *        the Bucket, i.e. the first Element in the Bucket.
+ *        Each Bucket holds the current number of Elements in the Bucket, and a pointer to
+ *        the head of the Bucket, i.e. the first Element in the Bucket.
+ *        The Bucket also holds a one byte tag of the Hash Code of each of it's first BUCKET_TAGS
+ *        Elements, in their order, so a search compares all the tags at once and follows the
+ *        chain only for the Elements whose tag matches.
+ *        The Buckets of a Table are stored in a single array, where an empty Bucket is all zeros,
+ *        and the capacity of all of them is the Bucket capacity of the Table.
  */
 typedef struct Bucket
 {
     ElementP head;
-    size_t bucketSize;
     size_t numberOfElements;
+    BucketTags tags;
 } Bucket;
 
+/**
+ * @brief A Structure representing a single Slot in a Robin Hood or a cuckoo Hash Table.
+ *        A Slot contains the key, the data and the full Hash Code of the key, so
+ *        a probe is a single load and resizing never calls the Hash function.
+ *        An empty Slot has a NULL key. Like an Element, a Slot may hold it's key inline, so the
+ *        Slots array has a stride of the Table's Slot size.
+ */
+typedef struct Slot
+{
+    KeyP key;
+    DataP data;
+    HashCode hashCode;
+    KeyStorage inlineKey[];
+} Slot;
+
+/**
+ * @brief A Structure representing a node in the search for a chain of displacements in a
+ *        cuckoo Hash Table. The object in the given Slot of the Bucket of the parent node
+ *        would move to the Bucket of this node.
+ */
+typedef struct CuckooPathNode
+{
+    size_t bucket;
+    int parent;
+    int slot;
+} CuckooPathNode;
+
+/**
+ * @brief A Structure representing the Hash Codes of a key, which are generated once per
+ *        operation, so the key is placed again without the Hash function if the Table resizes.
+ *        The original cell is the cell of the key in the original size of a SPAN_GROWTH Table.
+ */
+typedef struct KeyHash
+{
+    HashCode fullHashCode;
+    size_t originalCell;
+} KeyHash;
+
+/**
+ * @brief A Structure representing a range of cells of a Hash Table which a single thread of a
+ *        parallel resize rehashes into the new Table.
+ */
+typedef struct RehashRange
+{
+    BucketP oldTable;
+    BucketP newTable;
+    size_t newSize;
+    size_t firstCell;
+    size_t endCell;
+} RehashRange;
+
+/**
+ * @brief A Structure representing the work of a single thread of a parallel build.
+ *        A thread first hashes it's slice of the keys and counts them by partition, then writes
+ *        the indices of it's slice to the order array from it's offset in each partition, and
+ *        finally inserts the keys of it's own partition, which is a range of cells of the Table.
+ */
+typedef struct BuildTask
+{
+    TableP pTable;
+    const void *const *keys;
+    const DataP *objects;
+    ElementP *elements;
+    size_t *order;
+    size_t numberOfTasks;
+    size_t *partitionCounts;
+    size_t firstKey;
+    size_t endKey;
+    size_t firstOrder;
+    size_t endOrder;
+    size_t insertedElements;
+    bool failed;
+} BuildTask;
+
+/**
+ * @brief A Structure representing an iterator over the objects of a Hash Table.
+ *        A chained Table is walked cell by cell, first the cells of the current Table and then
+ *        the old cells of an incremental resize that were not moved yet, and each chain through
+ *        the link to it's current Element, so removing the current Element leaves the link on
+ *        the next one. A Robin Hood or cuckoo Table is walked Slot by Slot, and a Robin Hood
+ *        Table starts after an empty Slot, so the Slots which a removal shifts backwards were
+ *        not walked yet.
+ */
+typedef struct TableIter
+{
+    TableP pTable;
+    BucketP cells;
+    size_t numberOfCells;
+    bool inOldTable;
+    size_t position;
+    size_t firstSlot;
+    ElementP *link;
+    size_t listNode;
+    bool hasCurrent;
+    bool finished;
+} TableIter;
+
 /**
  * @brief A Structure representing the Generic Hash Table.
  *        Each Hash Table holds its size, which is it's capacity, and the current
  *        number of Elements in the Hash Table. Also it holds a pointer for a pointer to a Bucket,
  *        and several pointers for the required functions associated with the Hash Table.
  *        The Hash Table also holds it's original size (used for the hash code calculations),
- *        and a track of the resize process of the Table.
+ *        and a track of the resize process of the Table, which depends on it's Growth Mode.
+ *        While an incremental resize is in progress, the cells of the previous Table that
+ *        were not moved yet are kept in the old Table, the moved ones are NULL.
+ *        Once the Table is seeded, it's keys are hashed by the seeded Hash function under the
+ *        random seed of the Table.
+ *        The keys of a Table with a Key Arena are copied into it, and released only with it.
  */
 typedef struct Table
 {
     // Table Properties.
-    BucketP *table;
+    TableEngine engine;
+    BucketP table;
+    SlotP slots;
+    size_t slotSize;
+    SlotP spareSlots;
+    size_t stashedElements;
     size_t tableSize;
     size_t originalSize;
-    int sizeFactor;
+    size_t sizeFactor;
+    size_t numberOfElements;
+    GrowthMode growthMode;
+    size_t bucketCapacity;
+    double maxLoadFactor;
+    size_t growthFactor;
+    double minLoadFactor;
+    size_t shrinkLimit;
+    MemoryPoolP elementPool;
+    size_t inlineKeySize;
+    BucketP oldTable;
+    size_t oldSize;
+    size_t migrationIndex;
+    HashSeed hashSeed;
+    bool hashSeeded;
+    size_t floodChainLength;
+    KeyArenaP keyArena;
+    bool ownsKeyArena;
+    size_t resizeThreads;
 
     // Table Functions.
     CloneKeyFcn cloneKey;
     FreeKeyFcn freeKey;
     HashFcn hfun;
+    HashFcn64 hfun64;
+    SeededHashFcn seededHfun;
     PrintKeyFcn printKeyFun;
     PrintDataFcn printDataFun;
     ComparisonFcn fcomp;
+    KeySizeFcn keySize;
 } Table;
 
 
-/*-----=  Element Functions  =-----*/
+/*-----=  Key Functions  =-----*/
 
 
 /**
- * @brief Initialize an Element for the Hash Table with the given key and data.
- *        The function allocated memory for the new Element, if the allocation was failed at
- *        some point, the function will free all the memory that was already allocated
- *        and will return a NULL pointer.
- * @param key A pointer for the key of the Element.
- * @param object A pointer for the data of the Element.
- * @return A pointer for the new initialized Element, or NULL if the process failed.
+ * @brief Generates the full Hash Code of the given key, i.e. a Hash Code which is not reduced
+ *        to the size of the Hash Table. It is the 64 bit Hash Code if the Table has a 64 bit
+ *        Hash function, or the seeded Hash Code if the Table is seeded.
+ * @param pTable A pointer to the Hash Table.
+ * @param key A pointer to the key to generate HashCode.
+ * @param hashCode A pointer to update with the full Hash Code.
+ * @return true if the Hash function succeed, false otherwise.
  */
-static ElementP initializeElement(KeyP key, DataP object)
+static inline bool generateFullHashCode(const TableP pTable, ConstKeyP key, HashCode *hashCode)
 {
-    assert(key != NULL && object != NULL);
+    assert(pTable != NULL && key != NULL && hashCode != NULL);
 
-    ElementP pElement = NULL;
-    pElement = (ElementP)malloc(sizeof(Element));
-    // We continue the process only if the allocation for memory succeed.
-    if (pElement != NULL)
+    if (pTable -> hashSeeded)
     {
-        pElement -> data = object;
-        pElement -> key = key;
-        pElement -> next = NULL;
+        *hashCode = (pTable -> seededHfun)(key, &(pTable -> hashSeed));
+        return true;
+    }
+    if ((pTable -> hfun64) != NULL)
+    {
+        *hashCode = (pTable -> hfun64)(key);
+        return true;
     }
 
-    return pElement;
+    int fullHashCode = (pTable -> hfun)(key, FULL_HASH_RANGE);
+    if (fullHashCode < HASH_CODE_LOWER_BOUND)
+    {
+        return false;
+    }
+    *hashCode = (HashCode)fullHashCode;
+    return true;
 }
 
 /**
- * @brief Frees the memory and resources allocated to the given Element.
- *        If the given Element is NULL, no operation is performed.
- *        The function returns the next Element of the Element we are about to free.
- * @param pElement A pointer to the Element to free.
- * @param freeKey A pointer for the Free Key function.
- * @return A pointer to the next Element of the Element we are about to free.
+ * @brief Advances the given state of the generator of a seed and returns it's next word.
+ * @param state A pointer to the state of the generator.
+ * @return The next word of the generator.
  */
-static ElementP freeElement(ElementP pElement, FreeKeyFcn freeKey)
+static inline uint64_t nextSeedWord(uint64_t *state)
 {
-    assert(freeKey != NULL);
-
-    ElementP pNext = NULL;
-    if (pElement != NULL)
-    {
-        freeKey(pElement -> key);
-        pElement -> key = NULL;
-
-        pNext = pElement -> next;
-        pElement -> next = NULL;
+    assert(state != NULL);
 
-        free(pElement);
-    }
-    return pNext;
+    *state += SEED_INCREMENT;
+    uint64_t word = *state;
+    word = (word ^ (word >> SEED_SHIFT_1)) * SEED_MULTIPLIER_1;
+    word = (word ^ (word >> SEED_SHIFT_2)) * SEED_MULTIPLIER_2;
+    return word ^ (word >> SEED_SHIFT_3);
 }
 
 /**
- * @brief Return the pointer to the Element that exist in the table in cell number arrCell
- *        (where 0 is the first cell), and placement at listNode in the list
- *        (when 0 is the first node in the list, i.e. the node that is pointed from the
- *        table itself). If such Element not exist return NULL
- * @param table A pointer to the Table to search.
- * @param arrCell The cell number in the Hash Table.
- * @param listNode The placement of the Element in the specific cell number.
- * @return A pointer to the Element in the desired place, if such Element not exist return NULL.
+ * @brief Draws a random seed for the seeded Hash function of a Hash Table.
+ *        The seed is read from the random source of the system, and without one it is mixed
+ *        from the time and the address of the Table, so each Table gets it's own seed.
+ * @param seed A pointer to update with the seed.
+ * @param salt The address of the Table.
  */
-static ElementP reachElement(const TableP pTable, int arrCell, int listNode)
+static void generateHashSeed(HashSeed *seed, const void *salt)
 {
-    assert(pTable != NULL);
-    assert(arrCell >= INITIAL_INDEX || arrCell < (int)(pTable -> tableSize) - 1);
-
-    BucketP currentBucket = NULL;
-    currentBucket = (pTable -> table)[arrCell];
-    assert(currentBucket != NULL);
-    assert(listNode >= INITIAL_INDEX);
+    assert(seed != NULL);
 
-    if (listNode >= (int)(currentBucket -> bucketSize))
+    bool filled = false;
+    FILE *randomSource = fopen(RANDOM_SOURCE, "rb");
+    if (randomSource != NULL)
     {
-        return NULL;
+        filled = fread(seed, sizeof(HashSeed), 1, randomSource) == 1;
+        fclose(randomSource);
     }
 
-    ElementP pElement = NULL;
-    pElement = currentBucket -> head;
-
-    int i = INITIAL_INDEX;
-    while ((i < listNode) && (pElement != NULL))
+    if (!filled)
     {
-        pElement = pElement -> next;
-        i++;
+        uint64_t state = (uint64_t)time(NULL) ^ ((uint64_t)clock() << HASH_REDUCTION_SHIFT)
+                         ^ (uint64_t)(uintptr_t)salt;
+        seed -> k0 = nextSeedWord(&state);
+        seed -> k1 = nextSeedWord(&state);
     }
-
-    return pElement;
 }
 
-
-/*-----=  Bucket Functions  =-----*/
-
+/**
+ * @brief Returns the number of bytes reserved for an inline key after each Element or Slot.
+ * @param inlineKeySize The max size of an inline key, as given in the Table options.
+ * @return The inline key size rounded up to whole Key Storage units.
+ */
+static inline size_t getInlineStorageSize(size_t inlineKeySize)
+{
+    return ((inlineKeySize + sizeof(KeyStorage) - 1) / sizeof(KeyStorage)) * sizeof(KeyStorage);
+}
 
 /**
- * @brief Initialize a new Bucket in the Hash Table with the given Bucket size.
- *        The function allocated memory for the new Bucket, if the allocation was failed at
- *        some point, the function will free all the memory that was already allocated
- *        and will return a NULL pointer.
- * @param bucketSize The size of the Bucket, i.e. the number of Elements each Bucket contains.
- * @return A pointer for the new initialized Bucket, or NULL if the process failed.
+ * @brief Store the given key for the Hash Table. A key that fits the inline key size of the
+ *        Table is copied into the given storage, otherwise it is copied into the Key Arena of
+ *        the Table, or cloned with the cloneKey function if there is none.
+ *        If run out of memory, MEM_OUT is reported.
+ * @param pTable A pointer to the Hash Table.
+ * @param key The key to store.
+ * @param storage The inline storage of the Element or Slot that would hold the key.
+ * @return A pointer to the stored key, or NULL if out of memory.
  */
-static BucketP initializeBucket(size_t const bucketSize)
+static KeyP storeKey(const TableP pTable, ConstKeyP key, KeyStorage *storage)
 {
-    assert((int)bucketSize >= NO_ELEMENTS);
+    assert(pTable != NULL && key != NULL && storage != NULL);
 
-    BucketP pBucket = NULL;
-    pBucket = (BucketP)malloc(sizeof(Bucket));
-    // We continue the process only if the allocation for memory succeed.
-    if (pBucket != NULL)
+    if ((pTable -> inlineKeySize) == NO_INLINE_KEY && (pTable -> keyArena) == NULL)
     {
-        pBucket -> head = NULL;
-        pBucket -> bucketSize = bucketSize;
-        pBucket -> numberOfElements = NO_ELEMENTS;
+        return (pTable -> cloneKey)(key);
     }
 
-    return pBucket;
-}
+    // Without a Key Size function, all the keys have the inline key size.
+    size_t keySize = pTable -> inlineKeySize;
+    if ((pTable -> keySize) != NULL)
+    {
+        keySize = (pTable -> keySize)(key);
+    }
+
+    if (keySize <= (pTable -> inlineKeySize))
+    {
+        memcpy(storage, key, keySize);
+        return storage;
+    }
+    if ((pTable -> keyArena) == NULL)
+    {
+        return (pTable -> cloneKey)(key);
+    }
+
+    KeyP storedKey = arenaStoreKey(pTable -> keyArena, key, keySize);
+    if (storedKey == NULL)
+    {
+        reportError(MEM_OUT);
+    }
+    return storedKey;
+}
+
+/**
+ * @brief The Free Key function of a Table with a Key Arena, which keeps the key in the arena
+ *        until the arena itself is released.
+ * @param key The key to release.
+ */
+static void keepArenaKey(void *key)
+{
+    (void)key;
+}
 
 /**
- * @brief Frees the memory and resources allocated to the given Bucket.
- *        If the given Bucket is NULL, no operation is performed.
- * @param pBucket A pointer to the Bucket to free.
+ * @brief Release the given stored key. A key which is held in it's inline storage is left
+ *        as is, otherwise it is freed with the freeKey function.
+ * @param key The stored key to release.
+ * @param storage The inline storage of the Element or Slot that holds the key.
  * @param freeKey A pointer for the Free Key function.
  */
-static void freeBucket(BucketP pBucket, FreeKeyFcn freeKey)
+static inline void releaseKey(KeyP key, const KeyStorage *storage, FreeKeyFcn freeKey)
 {
     assert(freeKey != NULL);
 
-    if (pBucket != NULL)
+    if (key != (KeyP)storage)
     {
-        ElementP currentElement = pBucket -> head;
+        freeKey(key);
+    }
+}
 
-        // Free each Element in the Bucket.
-        while (currentElement != NULL)
-        {
-            currentElement = freeElement(currentElement, freeKey);
-        }
 
-        // Free the Bucket itself.
-        free(pBucket);
+/*-----=  Element Functions  =-----*/
+
+
+/**
+ * @brief Frees the memory and resources allocated to the given Element.
+ *        If the given Element is NULL, no operation is performed.
+ *        The function returns the next Element of the Element we are about to free.
+ * @param pElement A pointer to the Element to free.
+ * @param freeKey A pointer for the Free Key function.
+ * @param elementPool A pointer to the Memory Pool of the Elements.
+ * @return A pointer to the next Element of the Element we are about to free.
+ */
+static ElementP freeElement(ElementP pElement, FreeKeyFcn freeKey, MemoryPoolP elementPool)
+{
+    assert(freeKey != NULL && elementPool != NULL);
+
+    ElementP pNext = NULL;
+    if (pElement != NULL)
+    {
+        releaseKey(pElement -> key, pElement -> inlineKey, freeKey);
+        pElement -> key = NULL;
+
+        pNext = pElement -> next;
+        pElement -> next = NULL;
+
+        poolRelease(elementPool, pElement);
     }
+    return pNext;
 }
 
 /**
- * @brief Insert a new Element to the Bucket with the given key and data.
- *        The function creates a new Element and add it to the end of the Bucket chain.
- *        If the process fail for any reason, the function free all the
- *        allocated memory and return false.
- * @param pBucket A pointer to the Bucket to insert to.
- * @param key The key of the new Element to insert.
- * @param object The data of the new Element to insert.
- * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ * @brief Returns the number of cells of the Hash Table, including the cells of an incremental
+ *        resize that were not moved yet.
+ * @param pTable A pointer to the Table.
+ * @return The number of cells of the Hash Table.
  */
-static int bucketInsertElement(BucketP pBucket, KeyP key, DataP object)
+static size_t getNumberOfCells(const TableP pTable)
 {
-    assert(pBucket != NULL && key != NULL && object != NULL);
+    assert(pTable != NULL);
 
-    ElementP newElement = initializeElement(key, object);
-    if (newElement != NULL)
+    if ((pTable -> oldTable) != NULL)
     {
-        // Insert new Element to the end of the Bucket.
-        ElementP previousElement = NULL;
-        ElementP currentElement = pBucket -> head;
-        while (currentElement != NULL)
-        {
-            previousElement = currentElement;
-            currentElement = currentElement -> next;
-        }
+        return (pTable -> tableSize) + (pTable -> oldSize);
+    }
+    if ((pTable -> engine) == CUCKOO_ENGINE)
+    {
+        return (pTable -> tableSize) + CUCKOO_STASH_BUCKETS;
+    }
+    return pTable -> tableSize;
+}
 
-        // Update the last Element to point to the new Element.
-        if (previousElement == NULL)
-        {
-            pBucket -> head = newElement;
-        }
-        else
-        {
-            previousElement -> next = newElement;
-        }
+/**
+ * @brief Return the Bucket of the given cell. The cells of an incremental resize that were not
+ *        moved yet follow the cells of the current Table.
+ * @param pTable A pointer to the Table.
+ * @param arrCell The cell number in the Hash Table.
+ * @return A pointer to the Bucket of the cell, or NULL if the cell does not exist.
+ */
+static BucketP getCellBucket(const TableP pTable, size_t arrCell)
+{
+    assert(pTable != NULL);
 
-        assert((pBucket -> numberOfElements) < (pBucket -> bucketSize));
-        (pBucket -> numberOfElements)++;
-        return true;
+    size_t cell = arrCell;
+    if (cell < (pTable -> tableSize))
+    {
+        return &((pTable -> table)[cell]);
     }
 
-    return false;
+    cell -= pTable -> tableSize;
+    if ((pTable -> oldTable) != NULL && cell < (pTable -> oldSize))
+    {
+        return &((pTable -> oldTable)[cell]);
+    }
+    return NULL;
 }
 
 /**
- * @brief Removes the Element represented by the given key from the Bucket.
- *        If everything is OK, return the pointer to the ejected data, otherwise return NULL.
- * @param pBucket A pointer to the Bucket to remove from.
- * @param key The key to remove.
- * @param fcomp A pointer for the Key Comparison function.
- * @param freeKey A pointer for the Free Key function.
- * @return A pointer for the ejected data if succeed, otherwise return NULL.
+ * @brief Return the pointer to the Element that exist in the table in cell number arrCell
+ *        (where 0 is the first cell), and placement at listNode in the list
+ *        (when 0 is the first node in the list, i.e. the node that is pointed from the
+ *        table itself). If such Element not exist return NULL
+ * @param table A pointer to the Table to search.
+ * @param arrCell The cell number in the Hash Table.
+ * @param listNode The placement of the Element in the specific cell number.
+ * @return A pointer to the Element in the desired place, if such Element not exist return NULL.
  */
-static DataP bucketRemoveElement(BucketP pBucket, ConstKeyP key, ComparisonFcn fcomp,
-                                 FreeKeyFcn freeKey)
+static ElementP reachElement(const TableP pTable, size_t arrCell, size_t listNode)
 {
-    assert((pBucket != NULL) && (key != NULL));
-    assert((fcomp != NULL) && (freeKey != NULL));
+    assert(pTable != NULL);
+
+    BucketP currentBucket = NULL;
+    currentBucket = getCellBucket(pTable, arrCell);
+
+    if (currentBucket == NULL || listNode >= (currentBucket -> numberOfElements))
+    {
+        return NULL;
+    }
+
+    ElementP pElement = NULL;
+    pElement = currentBucket -> head;
+
+    size_t i = INITIAL_INDEX;
+    while ((i < listNode) && (pElement != NULL))
+    {
+        pElement = pElement -> next;
+        i++;
+    }
+
+    return pElement;
+}
+
+
+/**
+ * @brief Print a single key and it's data with the desired pattern.
+ * @param key The key to print.
+ * @param data The data to print.
+ * @param printKeyFun A pointer for the Print Key function.
+ * @param printDataFun A pointer for the Print Data function.
+ */
+static void printEntry(ConstKeyP key, const DataP data, PrintKeyFcn printKeyFun,
+                       PrintDataFcn printDataFun)
+{
+    printf(PREFIX_ELEMENT_PRINT);
+    printKeyFun(key);
+    printf(SEPARATOR_PRINT);
+    printDataFun(data);
+    printf(SUFFIX_ELEMENT_PRINT);
+}
+
+
+/*-----=  Bucket Functions  =-----*/
+
+
+/**
+ * @brief Returns the tag of the given full Hash Code, i.e. the top byte of it's mixed bits, so
+ *        Hash Codes which share their low bits, as the keys of a single cell do, get distinct tags.
+ * @param hashCode The full Hash Code.
+ * @return The tag of the Hash Code.
+ */
+static inline BucketTags getHashTag(HashCode hashCode)
+{
+    return (((uint64_t)hashCode * TAG_MULTIPLIER) >> TAG_SHIFT) & TAG_MASK;
+}
+
+/**
+ * @brief Sets the tag of the Element in the given place of the Bucket.
+ * @param pBucket A pointer to the Bucket.
+ * @param placement The placement of the Element in the Bucket, lower than BUCKET_TAGS.
+ * @param tag The tag of the Element.
+ */
+static inline void bucketSetTag(BucketP pBucket, size_t placement, BucketTags tag)
+{
+    assert(pBucket != NULL && placement < BUCKET_TAGS);
+
+    size_t shift = placement * TAG_BITS;
+    pBucket -> tags = ((pBucket -> tags) & ~((BucketTags)TAG_MASK << shift)) | (tag << shift);
+}
+
+/**
+ * @brief Returns the places of the tagged Elements of the Bucket whose tag is the given tag,
+ *        where bit i is set if the Element in placement i matches.
+ *        All the tags are compared at once, by finding the zero bytes of their difference from
+ *        the given tag within a single word.
+ * @param pBucket A pointer to the Bucket.
+ * @param tag The tag to match.
+ * @return The matches of the tag.
+ */
+static inline unsigned int bucketMatchTag(const BucketP pBucket, BucketTags tag)
+{
+    assert(pBucket != NULL);
 
-    DataP removedItem = NULL;
+    BucketTags difference = (pBucket -> tags) ^ (tag * TAG_LOW_BYTES);
+    BucketTags zeroBytes = ~(((difference & TAG_LOW_BITS) + TAG_LOW_BITS) | difference | TAG_LOW_BITS);
+    unsigned int matches = (unsigned int)((((zeroBytes >> (TAG_BITS - 1)) * TAG_GATHER_MULTIPLIER)
+                                           >> TAG_SHIFT) & TAG_MASK);
 
+    // The tags after the last Element of the Bucket are meaningless.
+    if ((pBucket -> numberOfElements) < BUCKET_TAGS)
+    {
+        matches &= (FIRST_TAG_MATCH << (pBucket -> numberOfElements)) - 1;
+    }
+    return matches;
+}
+
+/**
+ * @brief Removes the tag of the Element in the given place of the Bucket, after the Element was
+ *        unlinked, so the tags of the following Elements move back by one place. If the Bucket
+ *        still has more Elements than tags, the last tag is taken from the first untagged Element.
+ * @param pBucket A pointer to the Bucket, whose number of Elements is already updated.
+ * @param placement The placement of the unlinked Element in the Bucket.
+ * @param nextElement The Element which followed the unlinked Element, and now takes it's place.
+ */
+static void bucketRemoveTag(BucketP pBucket, size_t placement, ElementP nextElement)
+{
+    assert(pBucket != NULL);
+
+    if (placement >= BUCKET_TAGS)
+    {
+        return;
+    }
+
+    size_t shift = placement * TAG_BITS;
+    BucketTags lowerTags = (pBucket -> tags) & ((((BucketTags)FIRST_TAG_MATCH) << shift) - 1);
+    BucketTags upperTags = ((pBucket -> tags) >> shift >> TAG_BITS) << shift;
+    pBucket -> tags = lowerTags | upperTags;
+
+    if ((pBucket -> numberOfElements) >= BUCKET_TAGS)
+    {
+        for (size_t i = placement; i < BUCKET_TAGS - 1; i++)
+        {
+            nextElement = nextElement -> next;
+        }
+        bucketSetTag(pBucket, BUCKET_TAGS - 1, getHashTag(nextElement -> hashCode));
+    }
+}
+
+/**
+ * @brief Link the given Element to the end of the Bucket chain.
+ * @param pBucket A pointer to the Bucket to append to.
+ * @param pElement A pointer to the Element to append.
+ */
+static void bucketAppendElement(BucketP pBucket, ElementP pElement)
+{
+    assert(pBucket != NULL && pElement != NULL);
+
+    pElement -> next = NULL;
+
+    // Insert the Element to the end of the Bucket.
     ElementP previousElement = NULL;
     ElementP currentElement = pBucket -> head;
     while (currentElement != NULL)
     {
-        if (!fcomp(currentElement -> key, key))  // 'fcomp' returns 0 if the keys are equal.
-        {
-            // In case we found the matching Element, we store it's data, remove it from the Bucket
-            // and free it's memory.
-            removedItem = currentElement -> data;
-            if (previousElement == NULL)
-            {
-                // In case the Element to delete is the Head of the Bucket.
-                pBucket -> head = freeElement(currentElement, freeKey);
-            }
-            else
-            {
-                previousElement -> next = freeElement(currentElement, freeKey);
-            }
-            (pBucket -> numberOfElements)--;
-            break;
-        }
-        else
-        {
-            previousElement = currentElement;
-            currentElement = currentElement -> next;
-        }
+        previousElement = currentElement;
+        currentElement = currentElement -> next;
+    }
+
+    // Update the last Element to point to the new Element.
+    if (previousElement == NULL)
+    {
+        pBucket -> head = pElement;
+    }
+    else
+    {
+        previousElement -> next = pElement;
+    }
+
+    if ((pBucket -> numberOfElements) < BUCKET_TAGS)
+    {
+        bucketSetTag(pBucket, pBucket -> numberOfElements, getHashTag(pElement -> hashCode));
     }
+    (pBucket -> numberOfElements)++;
+}
+
+/**
+ * @brief Removes the Element which the given link points to from the Bucket, and frees it.
+ * @param pBucket A pointer to the Bucket to remove from.
+ * @param link The link to the Element, i.e. the head of the Bucket or the next pointer of the
+ *        previous Element.
+ * @param listNode The placement of the Element in the Bucket.
+ * @param freeKey A pointer for the Free Key function.
+ * @param elementPool A pointer to the Memory Pool of the Elements.
+ * @return A pointer for the ejected data.
+ */
+static DataP bucketUnlinkElement(BucketP pBucket, ElementP *link, size_t listNode,
+                                 FreeKeyFcn freeKey, MemoryPoolP elementPool)
+{
+    assert(pBucket != NULL && link != NULL && *link != NULL);
+    assert(freeKey != NULL && elementPool != NULL);
+
+    DataP removedItem = (*link) -> data;
+    *link = freeElement(*link, freeKey, elementPool);
+    (pBucket -> numberOfElements)--;
+    bucketRemoveTag(pBucket, listNode, *link);
     return removedItem;
 }
 
 /**
- * @brief Search the Bucket and look for an object with the given key.
- *        If such object is found fill its its placement in the list into listNode
+ * @brief Search the Bucket and look for an Element with the given key.
+ *        If such Element is found fill its placement in the list into listNode
  *        (when 0 is the first node in the Bucket).
- *        If the key was not found, fill both pointers with value of -1.
  * @param pBucket A pointer to the Bucket to search in.
  * @param key The key to search.
+ * @param hashCode The full Hash Code of the key.
  * @param listNode A pointer to update with the proper Node placement.
  * @param fcomp A pointer to the Comparison function.
- * @return A pointer to the data if found, otherwise return NULL.
+ * @return The link to the Element if found, i.e. the head of the Bucket or the next pointer of
+ *         the previous Element, otherwise return NULL.
  */
-static DataP bucketFindData(const BucketP pBucket, ConstKeyP key, int *listNode,
-                            ComparisonFcn fcomp)
+static ElementP *bucketFindLink(const BucketP pBucket, ConstKeyP key, HashCode hashCode,
+                                size_t *listNode, ComparisonFcn fcomp)
 {
     assert((pBucket != NULL) && (key != NULL));
     assert((fcomp != NULL) && (listNode != NULL));
 
-    DataP foundData = NULL;
+    // Once no tag matches, only the untagged Elements after the tagged ones may hold the key.
+    unsigned int matches = bucketMatchTag(pBucket, getHashTag(hashCode));
+    bool untaggedElements = (pBucket -> numberOfElements) > BUCKET_TAGS;
 
-    int bucketPlacement = INITIAL_INDEX;
-    ElementP currentElement = NULL;
-    currentElement = pBucket -> head;
-    while (currentElement != NULL)
+    size_t bucketPlacement = INITIAL_INDEX;
+    ElementP *link = &(pBucket -> head);
+    while (*link != NULL && (matches != NO_TAG_MATCHES || untaggedElements))
     {
-        if (!fcomp(currentElement -> key, key))  // 'fcomp' returns 0 if the keys are equal.
+        // 'fcomp' returns 0 if the keys are equal, and is called only if the Hash Codes are equal.
+        if ((bucketPlacement >= BUCKET_TAGS || (matches & FIRST_TAG_MATCH) != NO_TAG_MATCHES)
+            && ((*link) -> hashCode) == hashCode && !fcomp((*link) -> key, key))
         {
             *listNode = bucketPlacement;
-            foundData = currentElement -> data;
-            break;
+            return link;
         }
-        currentElement = currentElement -> next;
+        matches >>= 1;
+        link = &((*link) -> next);
         bucketPlacement++;
     }
 
-    return foundData;
+    return NULL;
 }
 
 /**
@@ -471,479 +1161,3606 @@ static void printBucket(const BucketP pBucket, PrintKeyFcn printKeyFun, PrintDat
     while (currentElement != NULL)
     {
         // Print the current Element.
-        printf(PREFIX_ELEMENT_PRINT);
-        printKeyFun(currentElement -> key);
-        printf(SEPARATOR_PRINT);
-        printDataFun(currentElement -> data);
-        printf(SUFFIX_ELEMENT_PRINT);
+        printEntry(currentElement -> key, currentElement -> data, printKeyFun, printDataFun);
         currentElement = currentElement -> next;
 
     }
 }
 
 
-/*-----=  Table Functions  =-----*/
+/*-----=  Load Functions  =-----*/
 
 
 /**
- * @brief Generates the proper HashCode that accustomed to the given Hash Table for the given key.
+ * @brief Checks whether the Hash Table has too few objects for it's size, i.e. the load is
+ *        below the min load factor and the Table is larger than it's original size.
+ *        If the last shrink failed, the Table waits until it has fewer objects than the shrink
+ *        limit, so a Table which can not shrink does not try again on every removal.
  * @param pTable A pointer to the Hash Table.
- * @param key A pointer to the key to generate HashCode.
- * @return The modified HashCode that accustomed to the given Hash Table.
+ * @return true if the Table should shrink, false otherwise.
  */
-static inline int generateHashCode(TableP pTable, ConstKeyP key)
+static inline bool isUnderloaded(const TableP pTable)
 {
-    assert(pTable != NULL && key != NULL);
-    return (pTable -> sizeFactor) * (pTable -> hfun)(key, pTable -> originalSize);
+    assert(pTable != NULL);
+
+    if ((pTable -> oldTable) != NULL || (pTable -> numberOfElements) >= (pTable -> shrinkLimit))
+    {
+        return false;
+    }
+    return (pTable -> tableSize) / (pTable -> growthFactor) >= (pTable -> originalSize)
+           && (pTable -> numberOfElements) < (pTable -> minLoadFactor) * (pTable -> tableSize);
 }
 
+
+/*-----=  Robin Hood Functions  =-----*/
+
+
 /**
- * @brief Updates the current size factor for the given Hash Table.
- *        The size factor is the Resize Factor raised to the number of times we resize the Table.
- *        where the Resize Factor is the number in which we multiply the table size each
- *        time we resize it.
- * @param pTable A pointer to the Hash Table to update.
+ * @brief Returns the distance of the Slot at the given index from the home Slot of it's key,
+ *        i.e. the Slot that the Hash Code of the key points to.
+ * @param hashCode The full Hash Code of the key in the Slot.
+ * @param index The index of the Slot.
+ * @param numberOfSlots The number of Slots in the Table.
+ * @return The number of Slots between the home Slot and the given index.
  */
-static inline void updateSizeFactor(TableP pTable)
+static inline size_t getProbeDistance(HashCode hashCode, size_t index, size_t numberOfSlots)
 {
-    assert(pTable != NULL);
-    pTable -> sizeFactor *= RESIZE_FACTOR;
+    size_t homeIndex = reduceHashCode(hashCode, numberOfSlots);
+    return (index >= homeIndex) ? index - homeIndex : index + numberOfSlots - homeIndex;
 }
 
 /**
- * @brief Allocate a Bucket in each cell in the given Table (a pointer to pointer to Buckets).
- * @param table The Table to set.
- * @param tableSize The size of the Table.
- * @param freeKey The pointer for the Free Key Function.
- * @return true if the process succeed, false otherwise.
+ * @brief Returns the index of the Slot which follows the given one in a probe sequence.
+ * @param index The index of the Slot.
+ * @param numberOfSlots The number of Slots in the Table.
+ * @return The index of the next Slot, which wraps around to the first Slot.
+ */
+static inline size_t getNextSlotIndex(size_t index, size_t numberOfSlots)
+{
+    return (index + 1 < numberOfSlots) ? index + 1 : INITIAL_INDEX;
+}
+
+/**
+ * @brief Return the Slot at the given index of the given Slots array.
+ * @param slots The Slots array.
+ * @param slotSize The size of each Slot in the array.
+ * @param index The index of the Slot.
+ * @return A pointer to the Slot.
+ */
+static inline SlotP getSlot(SlotP slots, size_t slotSize, size_t index)
+{
+    return (SlotP)((char *)slots + index * slotSize);
+}
+
+/**
+ * @brief Returns the number of Slots of the given Hash Table, i.e. one Slot in each cell of a
+ *        Robin Hood Table, or the Slots of the Buckets and of the stash of a cuckoo Table.
+ * @param pTable A pointer to the Hash Table.
+ * @return The number of Slots.
  */
-static bool setTableBuckets(BucketP *table, size_t tableSize, FreeKeyFcn freeKey)
+static inline size_t getNumberOfSlots(const TableP pTable)
 {
-    assert(table != NULL && freeKey != NULL);
+    assert(pTable != NULL && (pTable -> engine) != CHAINED_ENGINE);
 
-    // Attempt to set each Bucket in the Table.
-    int currentIndex = INITIAL_INDEX;
-    while (currentIndex < (int)tableSize)
+    if ((pTable -> engine) == CUCKOO_ENGINE)
     {
-        BucketP pBucket = initializeBucket(MAX_ROW_ELEMENTS);
-        if (pBucket == NULL)
-        {
-            // If memory allocation failed, we stop the process.
-            break;
-        }
-        table[currentIndex] = pBucket;
-        currentIndex++;
+        return ((pTable -> tableSize) + CUCKOO_STASH_BUCKETS) * CUCKOO_BUCKET_SLOTS;
     }
+    return pTable -> tableSize;
+}
 
-    if (currentIndex != (int)tableSize)
+/**
+ * @brief Copy the source Slot over the destination Slot. A key which is held inline moves
+ *        with the Slot, so the key of the destination points to it's own inline storage.
+ * @param destination The Slot to copy to.
+ * @param source The Slot to copy from.
+ * @param slotSize The size of each Slot.
+ */
+static inline void copySlot(SlotP destination, const SlotP source, size_t slotSize)
+{
+    memcpy(destination, source, slotSize);
+    if ((source -> key) == (KeyP)(source -> inlineKey))
     {
-        // In this case, the While Loop broke during the run, which means that some
-        // memory allocation was failed, so we will free all the memory that was already allocated.
-        for (int j = INITIAL_INDEX; j < currentIndex; j++)
-        {
-            freeBucket(table[currentIndex], freeKey);
-            table[currentIndex] = NULL;
-        }
-        return false;
+        destination -> key = destination -> inlineKey;
     }
-    return true;
 }
 
 /**
- * @brief Initialize a new Hash Table with the given table size.
- *        The function allocated memory for the new Hash Table, if the allocation was failed at
- *        some point, the function will free all the memory that was already allocated
- *        and will return a NULL pointer.
- * @param tableSize The size of the Hash Table to set.
- * @param cloneKey A pointer for the Key Cloning function.
- * @param freeKey A pointer for the Free Key function.
- * @param hfun A pointer for the Hash function.
- * @param printKeyFun A pointer for the Print Key function.
- * @param printDataFun A pointer for the Print Data function.
- * @param fcomp A pointer for the Key Comparison function.
- * @return A pointer for the new initialized Hash Table, or NULL if the process failed.
+ * @brief Place the carried spare Slot of the Hash Table in the given Slots array with
+ *        Robin Hood linear probing. Whenever the probed Slot is closer to it's home than the
+ *        carried one, the two swap and the displaced Slot continues the probing.
+ *        The array must have at least one empty Slot.
+ * @param pTable A pointer to the Hash Table, which carries the Slot to place.
+ * @param slots The Slots array to place in.
+ * @param numberOfSlots The number of Slots in the array.
+ * @return The index in which the carried Slot was placed.
  */
-static TableP initializeTable(size_t tableSize, CloneKeyFcn cloneKey, FreeKeyFcn freeKey,
-                              HashFcn hfun, PrintKeyFcn printKeyFun, PrintDataFcn printDataFun,
-                              ComparisonFcn fcomp)
+static size_t robinHoodPlaceCarriedSlot(TableP pTable, SlotP slots, size_t numberOfSlots)
 {
-    assert(cloneKey != NULL && freeKey != NULL && hfun != NULL && printKeyFun != NULL
-           && printDataFun != NULL && fcomp != NULL);
+    assert(pTable != NULL && slots != NULL);
 
-    TableP pTable = NULL;
+    size_t slotSize = pTable -> slotSize;
+    SlotP carriedSlot = getSlot(pTable -> spareSlots, slotSize, CARRIED_SLOT);
+    SlotP swappedSlot = getSlot(pTable -> spareSlots, slotSize, SWAPPED_SLOT);
+    assert((carriedSlot -> key) != NULL);
 
-    pTable = (TableP)malloc(sizeof(Table));
-    // We continue the process only if the allocation for memory succeed.
-    if (pTable != NULL)
+    size_t index = reduceHashCode(carriedSlot -> hashCode, numberOfSlots);
+    size_t distance = INITIAL_INDEX;
+    bool placed = false;
+    size_t placedIndex = index;
+    SlotP currentSlot = getSlot(slots, slotSize, index);
+    while ((currentSlot -> key) != NULL)
     {
-        pTable -> table = (BucketP *)malloc(tableSize * sizeof(BucketP));
-        // We continue the process only if the allocation for memory succeed.
-        if ((pTable -> table) != NULL)
+        size_t currentDistance = getProbeDistance(currentSlot -> hashCode, index, numberOfSlots);
+        if (currentDistance < distance)
         {
-            pTable -> tableSize = tableSize;
-            pTable -> originalSize = tableSize;
-            pTable -> sizeFactor = INITIAL_SIZE_FACTOR;
-
-            // Set the Bucket in the Hash Table.
-            if (setTableBuckets((pTable -> table), tableSize, freeKey))
+            // The current Slot is richer than the carried one, so it gives away it's place.
+            copySlot(swappedSlot, currentSlot, slotSize);
+            copySlot(currentSlot, carriedSlot, slotSize);
+            copySlot(carriedSlot, swappedSlot, slotSize);
+            distance = currentDistance;
+            if (!placed)
             {
-                // If the allocation for memory succeed.
-                // Assign the given functions to the Hash Table.
-                pTable -> cloneKey = cloneKey;
-                pTable -> freeKey = freeKey;
-                pTable -> hfun = hfun;
-                pTable -> printKeyFun = printKeyFun;
-                pTable -> printDataFun = printDataFun;
-                pTable -> fcomp = fcomp;
+                placed = true;
+                placedIndex = index;
             }
-            else
-            {
-                // If memory allocation failed, we free all the memory that was already allocated.
-                free(pTable -> table);
-                pTable -> table = NULL;
-                free(pTable);
-                pTable = NULL;
-            }
-        }
-        else
-        {
-            // If memory allocation failed, we free all the memory that was already allocated.
-            free(pTable);
-            pTable = NULL;
         }
+        index = getNextSlotIndex(index, numberOfSlots);
+        distance++;
+        currentSlot = getSlot(slots, slotSize, index);
     }
-    return pTable;
+    copySlot(currentSlot, carriedSlot, slotSize);
+    return placed ? placedIndex : index;
 }
 
 /**
- * @brief Resize the Hash Table and allocate the current Elements in the updated cells in the Table.
- * @param pTable A pointer to the Hash Table to resize.
- * @return true if the process succeed, false if out of memory.
+ * @brief Search the Robin Hood Hash Table for the Slot which holds the given key.
+ *        The search stops at an empty Slot, or at a Slot closer to it's home than the key
+ *        would be, since the key would have displaced it.
+ * @param pTable A pointer to the Hash Table to search in.
+ * @param key The key to search.
+ * @param hashCode The full Hash Code of the key.
+ * @return The index of the Slot if found, otherwise return NO_POSITION.
+ */
+static size_t robinHoodFindSlot(const TableP pTable, ConstKeyP key, HashCode hashCode)
+{
+    assert(pTable != NULL && key != NULL);
+
+    size_t numberOfSlots = pTable -> tableSize;
+    size_t index = reduceHashCode(hashCode, numberOfSlots);
+    for (size_t distance = INITIAL_INDEX; distance < numberOfSlots; distance++)
+    {
+        SlotP currentSlot = getSlot(pTable -> slots, pTable -> slotSize, index);
+        if ((currentSlot -> key) == NULL
+            || getProbeDistance(currentSlot -> hashCode, index, numberOfSlots) < distance)
+        {
+            break;
+        }
+
+        // The Hash Codes are compared first, so 'fcomp' is called only on a probable match.
+        if ((currentSlot -> hashCode) == hashCode && !(pTable -> fcomp)(currentSlot -> key, key))
+        {
+            return index;
+        }
+        index = getNextSlotIndex(index, numberOfSlots);
+    }
+    return NO_POSITION;
+}
+
+/**
+ * @brief Resize the Robin Hood Hash Table to the given size, placing each Slot by it's
+ *        cached Hash Code, so the Hash function is not called during the process.
+ * @param pTable A pointer to the Hash Table to resize.
+ * @param newSize The new number of Slots, greater than the number of Elements.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool robinHoodResize(TableP pTable, size_t newSize)
+{
+    assert(pTable != NULL && newSize > (pTable -> numberOfElements));
+
+    size_t slotSize = pTable -> slotSize;
+    SlotP newSlots = (SlotP)calloc(newSize, slotSize);
+    if (newSlots == NULL)
+    {
+        return false;
+    }
+
+    SlotP carriedSlot = getSlot(pTable -> spareSlots, slotSize, CARRIED_SLOT);
+    for (size_t i = INITIAL_INDEX; i < (pTable -> tableSize); i++)
+    {
+        SlotP currentSlot = getSlot(pTable -> slots, slotSize, i);
+        if ((currentSlot -> key) != NULL)
+        {
+            copySlot(carriedSlot, currentSlot, slotSize);
+            robinHoodPlaceCarriedSlot(pTable, newSlots, newSize);
+        }
+    }
+
+    free(pTable -> slots);
+    pTable -> slots = newSlots;
+    pTable -> tableSize = newSize;
+    pTable -> shrinkLimit = NO_SHRINK_LIMIT;
+    return true;
+}
+
+/**
+ * @brief Search the Robin Hood Hash Table for the given key, and insert it with the given object
+ *        if it is not found. If the Table is too loaded for the new key, the Table is resized first.
+ * @param pTable A pointer for the Hash Table.
+ * @param key The key to search or insert.
+ * @param hashCode The full Hash Code of the key.
+ * @param object The object to store by the key if it is inserted.
+ * @param found A pointer to update with whether the key was already in the Table.
+ * @return A pointer to the data of the key in it's Slot, or NULL if an error occurred.
+ */
+static DataP *robinHoodLookupOrInsert(TableP pTable, const void *key, HashCode hashCode,
+                                      DataP object, bool *found)
+{
+    assert(pTable != NULL && key != NULL && object != NULL && found != NULL);
+
+    size_t index = robinHoodFindSlot(pTable, key, hashCode);
+    if (index != NO_POSITION)
+    {
+        *found = true;
+        return &(getSlot(pTable -> slots, pTable -> slotSize, index) -> data);
+    }
+    *found = false;
+
+    if ((pTable -> numberOfElements) + 1 > (pTable -> maxLoadFactor) * (pTable -> tableSize))
+    {
+        if (!robinHoodResize(pTable, (pTable -> tableSize) * (pTable -> growthFactor)))
+        {
+            reportError(MEM_OUT);
+            return NULL;
+        }
+    }
+
+    SlotP carriedSlot = getSlot(pTable -> spareSlots, pTable -> slotSize, CARRIED_SLOT);
+    carriedSlot -> key = storeKey(pTable, key, carriedSlot -> inlineKey);
+    if ((carriedSlot -> key) == NULL)
+    {
+        // The cloneKey function already reports of MEM_OUT.
+        return NULL;
+    }
+    carriedSlot -> data = object;
+    carriedSlot -> hashCode = hashCode;
+
+    size_t placedIndex = robinHoodPlaceCarriedSlot(pTable, pTable -> slots, pTable -> tableSize);
+    (pTable -> numberOfElements)++;
+    return &(getSlot(pTable -> slots, pTable -> slotSize, placedIndex) -> data);
+}
+
+/**
+ * @brief Remove the object in the given Slot of the Robin Hood Hash Table.
+ *        The following Slots of the probe sequence are shifted one Slot backwards,
+ *        so no tombstones are left behind. The shift stops at an empty Slot.
+ * @param pTable A pointer for the Hash Table to remove from.
+ * @param index The index of the Slot, which holds an object.
+ * @return pointer to the ejected data.
+ */
+static DataP robinHoodRemoveSlot(TableP pTable, size_t index)
+{
+    assert(pTable != NULL && index < (pTable -> tableSize));
+
+    size_t slotSize = pTable -> slotSize;
+    size_t numberOfSlots = pTable -> tableSize;
+    SlotP holeSlot = getSlot(pTable -> slots, slotSize, index);
+    DataP removedData = holeSlot -> data;
+    releaseKey(holeSlot -> key, holeSlot -> inlineKey, pTable -> freeKey);
+
+    // Shift back each following Slot until an empty Slot or a Slot at it's home.
+    size_t nextIndex = getNextSlotIndex(index, numberOfSlots);
+    SlotP nextSlot = getSlot(pTable -> slots, slotSize, nextIndex);
+    while ((nextSlot -> key) != NULL
+           && getProbeDistance(nextSlot -> hashCode, nextIndex, numberOfSlots) > INITIAL_INDEX)
+    {
+        copySlot(holeSlot, nextSlot, slotSize);
+        holeSlot = nextSlot;
+        nextIndex = getNextSlotIndex(nextIndex, numberOfSlots);
+        nextSlot = getSlot(pTable -> slots, slotSize, nextIndex);
+    }
+    holeSlot -> key = NULL;
+    holeSlot -> data = NULL;
+
+    (pTable -> numberOfElements)--;
+    return removedData;
+}
+
+/**
+ * @brief Remove a data from the Robin Hood Hash Table.
+ * @param pTable A pointer for the Hash Table to remove from.
+ * @param key The key to remove.
+ * @param hashCode The full Hash Code of the key.
+ * @return pointer to the ejected data if the remove process succeed, otherwise return NULL.
+ */
+static DataP robinHoodRemove(TableP pTable, const void *key, HashCode hashCode)
+{
+    assert(pTable != NULL && key != NULL);
+
+    size_t index = robinHoodFindSlot(pTable, key, hashCode);
+    if (index == NO_POSITION)
+    {
+        return NULL;
+    }
+    return robinHoodRemoveSlot(pTable, index);
+}
+
+/**
+ * @brief Search the Robin Hood Hash Table and look for an object with the given key.
+ *        If such object is found fill it's Slot index into arrCell, and 0 into listNode.
+ * @param pTable A pointer for the Hash Table to search in.
+ * @param key The key to search.
+ * @param hashCode The full Hash Code of the key.
+ * @param arrCell A pointer to update with the proper cell number.
+ * @param listNode A pointer to update with the proper Node placement.
+ * @return A pointer to the data if found, otherwise return NULL.
+ */
+static DataP robinHoodFindData(const TableP pTable, const void *key, HashCode hashCode,
+                               size_t *arrCell, size_t *listNode)
+{
+    assert(pTable != NULL && key != NULL && arrCell != NULL && listNode != NULL);
+
+    size_t index = robinHoodFindSlot(pTable, key, hashCode);
+    if (index == NO_POSITION)
+    {
+        return NULL;
+    }
+
+    *arrCell = index;
+    *listNode = SINGLE_SLOT_NODE;
+    return getSlot(pTable -> slots, pTable -> slotSize, index) -> data;
+}
+
+/**
+ * @brief Return the Slot of the Robin Hood Hash Table in the given place, if it holds an object.
+ * @param pTable A pointer to the Table.
+ * @param arrCell The cell number in the Hash Table.
+ * @param listNode The placement in the specific cell number.
+ * @return A pointer to the Slot in the desired place, if it's empty or not exist return NULL.
+ */
+static SlotP robinHoodReachSlot(const TableP pTable, size_t arrCell, size_t listNode)
+{
+    assert(pTable != NULL && arrCell < (pTable -> tableSize));
+
+    SlotP pSlot = getSlot(pTable -> slots, pTable -> slotSize, arrCell);
+    if (listNode != SINGLE_SLOT_NODE || (pSlot -> key) == NULL)
+    {
+        return NULL;
+    }
+    return pSlot;
+}
+
+/**
+ * @brief Frees the keys held by the Slots of the Robin Hood or cuckoo Hash Table and the
+ *        Slots array. The keys of a Key Arena are left to it.
+ * @param pTable A pointer to the Table to free it's Slots.
+ */
+static void freeSlots(TableP pTable)
+{
+    assert(pTable != NULL);
+
+    if ((pTable -> slots) != NULL)
+    {
+        // The keys of a Key Arena are released with it, so the Slots are not visited.
+        size_t numberOfSlots = ((pTable -> keyArena) == NULL) ? getNumberOfSlots(pTable) : NO_ELEMENTS;
+        for (size_t i = INITIAL_INDEX; i < numberOfSlots; i++)
+        {
+            SlotP currentSlot = getSlot(pTable -> slots, pTable -> slotSize, i);
+            if ((currentSlot -> key) != NULL)
+            {
+                releaseKey(currentSlot -> key, currentSlot -> inlineKey, pTable -> freeKey);
+            }
+        }
+        free(pTable -> slots);
+        pTable -> slots = NULL;
+    }
+    free(pTable -> spareSlots);
+    pTable -> spareSlots = NULL;
+}
+
+
+/*-----=  Cuckoo Functions  =-----*/
+
+
+/**
+ * @brief Returns the two Buckets of a key with the given full Hash Code in a cuckoo Hash Table.
+ *        The first Bucket is the Hash Code reduced to the number of Buckets, and the second one
+ *        is the mixed Hash Code reduced to it, which differs from the first if there are two
+ *        Buckets or more.
+ * @param hashCode The full Hash Code of the key.
+ * @param numberOfBuckets The number of Buckets of the Table, without the stash.
+ * @param secondBucket A pointer to update with the second Bucket.
+ * @return The first Bucket.
+ */
+static inline size_t getCuckooBuckets(HashCode hashCode, size_t numberOfBuckets,
+                                      size_t *secondBucket)
+{
+    assert(numberOfBuckets > NO_ELEMENTS && secondBucket != NULL);
+
+    size_t firstBucket = reduceHashCode(hashCode, numberOfBuckets);
+    HashCode mixedHashCode = (HashCode)(((uint64_t)hashCode * CUCKOO_HASH_MULTIPLIER)
+                                        >> CUCKOO_HASH_SHIFT);
+    *secondBucket = reduceHashCode(mixedHashCode, numberOfBuckets);
+    if (*secondBucket == firstBucket)
+    {
+        *secondBucket = (firstBucket + 1) % numberOfBuckets;
+    }
+    return firstBucket;
+}
+
+/**
+ * @brief Returns the index of an empty Slot in the given Bucket of a cuckoo Hash Table.
+ * @param pTable A pointer to the Hash Table.
+ * @param slots The Slots array.
+ * @param bucket The Bucket to search, which may be the stash.
+ * @return The placement of the empty Slot in the Bucket, or INVALID_INDEX if the Bucket is full.
+ */
+static int cuckooFindEmptySlot(const TableP pTable, SlotP slots, size_t bucket)
+{
+    assert(pTable != NULL && slots != NULL);
+
+    for (int i = INITIAL_INDEX; i < CUCKOO_BUCKET_SLOTS; i++)
+    {
+        if (getSlot(slots, pTable -> slotSize, bucket * CUCKOO_BUCKET_SLOTS + i) -> key == NULL)
+        {
+            return i;
+        }
+    }
+    return INVALID_INDEX;
+}
+
+/**
+ * @brief Search the given Bucket of the cuckoo Hash Table for the given key.
+ * @param pTable A pointer to the Hash Table.
+ * @param bucket The Bucket to search, which may be the stash.
+ * @param key The key to search.
+ * @param hashCode The full Hash Code of the key.
+ * @return The index of the Slot if found, otherwise return NO_POSITION.
+ */
+static size_t cuckooSearchBucket(const TableP pTable, size_t bucket, ConstKeyP key, HashCode hashCode)
+{
+    assert(pTable != NULL && key != NULL);
+
+    for (size_t i = INITIAL_INDEX; i < CUCKOO_BUCKET_SLOTS; i++)
+    {
+        size_t index = bucket * CUCKOO_BUCKET_SLOTS + i;
+        SlotP currentSlot = getSlot(pTable -> slots, pTable -> slotSize, index);
+
+        // The Hash Codes are compared first, so 'fcomp' is called only on a probable match.
+        if ((currentSlot -> key) != NULL && (currentSlot -> hashCode) == hashCode
+            && !(pTable -> fcomp)(currentSlot -> key, key))
+        {
+            return index;
+        }
+    }
+    return NO_POSITION;
+}
+
+/**
+ * @brief Search the cuckoo Hash Table for the given key. A key is always in one of it's two
+ *        Buckets or in the stash, so no more than two Buckets and the stash are searched.
+ * @param pTable A pointer to the Hash Table to search in.
+ * @param key The key to search.
+ * @param hashCode The full Hash Code of the key.
+ * @return The index of the Slot if found, otherwise return NO_POSITION.
+ */
+static size_t cuckooFindSlot(const TableP pTable, ConstKeyP key, HashCode hashCode)
+{
+    assert(pTable != NULL && key != NULL);
+
+    size_t secondBucket = INITIAL_INDEX;
+    size_t firstBucket = getCuckooBuckets(hashCode, pTable -> tableSize, &secondBucket);
+    size_t index = cuckooSearchBucket(pTable, firstBucket, key, hashCode);
+    if (index == NO_POSITION && secondBucket != firstBucket)
+    {
+        index = cuckooSearchBucket(pTable, secondBucket, key, hashCode);
+    }
+    if (index == NO_POSITION && (pTable -> stashedElements) > NO_ELEMENTS)
+    {
+        index = cuckooSearchBucket(pTable, pTable -> tableSize, key, hashCode);
+    }
+    return index;
+}
+
+/**
+ * @brief Checks whether the given Bucket is on the path from the given node of a cuckoo
+ *        displacement search back to it's first node.
+ * @param path The nodes of the search.
+ * @param node The node to start from.
+ * @param bucket The Bucket to look for.
+ * @return true if the Bucket is on the path, false otherwise.
+ */
+static bool cuckooPathContains(const CuckooPathNode *path, int node, size_t bucket)
+{
+    assert(path != NULL);
+
+    for (; node != NO_PARENT_NODE; node = path[node].parent)
+    {
+        if (path[node].bucket == bucket)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Add a node to a cuckoo displacement search.
+ * @param path The nodes of the search.
+ * @param numberOfNodes A pointer to the number of nodes of the search, which is updated.
+ * @param bucket The Bucket of the new node.
+ * @param parent The parent node, or NO_PARENT_NODE.
+ * @param slot The Slot of the Bucket of the parent node whose object would move to the Bucket.
+ */
+static inline void cuckooAddPathNode(CuckooPathNode *path, int *numberOfNodes, size_t bucket,
+                                     int parent, int slot)
+{
+    assert(path != NULL && numberOfNodes != NULL && *numberOfNodes < CUCKOO_MAX_SEARCH);
+
+    path[*numberOfNodes].bucket = bucket;
+    path[*numberOfNodes].parent = parent;
+    path[*numberOfNodes].slot = slot;
+    (*numberOfNodes)++;
+}
+
+/**
+ * @brief Move each object on the path from the first node of a cuckoo displacement search to the
+ *        given node one step forward, starting with the last, into the empty Slot of the Bucket
+ *        of the given node. The Buckets of a path are distinct, so each object is still where
+ *        the search found it.
+ * @param pTable A pointer to the Hash Table.
+ * @param slots The Slots array.
+ * @param path The nodes of the search.
+ * @param node The node whose Bucket has an empty Slot.
+ * @param emptySlot The placement of the empty Slot in the Bucket of the node.
+ * @return The index of the Slot which was freed in the Bucket of the first node of the path.
+ */
+static size_t cuckooShiftPath(const TableP pTable, SlotP slots, const CuckooPathNode *path,
+                              int node, int emptySlot)
+{
+    assert(pTable != NULL && slots != NULL && path != NULL);
+
+    size_t slotSize = pTable -> slotSize;
+    size_t emptyIndex = path[node].bucket * CUCKOO_BUCKET_SLOTS + (size_t)emptySlot;
+    while (path[node].parent != NO_PARENT_NODE)
+    {
+        size_t movedIndex = path[path[node].parent].bucket * CUCKOO_BUCKET_SLOTS
+                            + (size_t)path[node].slot;
+        SlotP movedSlot = getSlot(slots, slotSize, movedIndex);
+        copySlot(getSlot(slots, slotSize, emptyIndex), movedSlot, slotSize);
+        movedSlot -> key = NULL;
+        movedSlot -> data = NULL;
+
+        emptyIndex = movedIndex;
+        node = path[node].parent;
+    }
+    return emptyIndex;
+}
+
+/**
+ * @brief Find an empty Slot for a new object with the given full Hash Code in the given Slots of
+ *        a cuckoo Hash Table. If both Buckets of the object are full, the shortest chain of
+ *        displacements which frees a Slot in one of them is searched breadth first, up to
+ *        CUCKOO_MAX_SEARCH Buckets, and performed. If there is no such chain, an empty Slot of the
+ *        stash is used.
+ * @param pTable A pointer to the Hash Table.
+ * @param slots The Slots array.
+ * @param numberOfBuckets The number of Buckets of the Slots array, without the stash.
+ * @param hashCode The full Hash Code of the new object.
+ * @return The index of the empty Slot, or NO_POSITION if there is none, in which case the
+ *         Slots are left as they were.
+ */
+static size_t cuckooMakeRoom(const TableP pTable, SlotP slots, size_t numberOfBuckets,
+                          HashCode hashCode)
+{
+    assert(pTable != NULL && slots != NULL);
+
+    CuckooPathNode path[CUCKOO_MAX_SEARCH];
+    int numberOfNodes = INITIAL_INDEX;
+    size_t secondBucket = INITIAL_INDEX;
+    size_t firstBucket = getCuckooBuckets(hashCode, numberOfBuckets, &secondBucket);
+    cuckooAddPathNode(path, &numberOfNodes, firstBucket, NO_PARENT_NODE, INVALID_INDEX);
+    if (secondBucket != firstBucket)
+    {
+        cuckooAddPathNode(path, &numberOfNodes, secondBucket, NO_PARENT_NODE, INVALID_INDEX);
+    }
+
+    for (int node = INITIAL_INDEX; node < numberOfNodes; node++)
+    {
+        size_t bucket = path[node].bucket;
+        int emptySlot = cuckooFindEmptySlot(pTable, slots, bucket);
+        if (emptySlot != INVALID_INDEX)
+        {
+            return cuckooShiftPath(pTable, slots, path, node, emptySlot);
+        }
+
+        // Each object of a full Bucket may move to it's other Bucket.
+        for (int i = INITIAL_INDEX; i < CUCKOO_BUCKET_SLOTS && numberOfNodes < CUCKOO_MAX_SEARCH; i++)
+        {
+            HashCode movedHashCode = getSlot(slots, pTable -> slotSize,
+                                             bucket * CUCKOO_BUCKET_SLOTS + i) -> hashCode;
+            size_t otherBucket = getCuckooBuckets(movedHashCode, numberOfBuckets, &secondBucket);
+            if (otherBucket == bucket)
+            {
+                otherBucket = secondBucket;
+            }
+            if (!cuckooPathContains(path, node, otherBucket))
+            {
+                cuckooAddPathNode(path, &numberOfNodes, otherBucket, node, i);
+            }
+        }
+    }
+
+    int stashSlot = cuckooFindEmptySlot(pTable, slots, numberOfBuckets);
+    if (stashSlot == INVALID_INDEX)
+    {
+        return NO_POSITION;
+    }
+    return numberOfBuckets * CUCKOO_BUCKET_SLOTS + (size_t)stashSlot;
+}
+
+/**
+ * @brief Resize the cuckoo Hash Table to the given number of Buckets, placing each Slot by it's
+ *        cached Hash Code, so the Hash function is not called during the process.
+ * @param pTable A pointer to the Hash Table to resize.
+ * @param newSize The new number of Buckets.
+ * @param outOfMemory A pointer to update with whether the process failed for lack of memory,
+ *        rather than because the objects could not all be placed.
+ * @return true if the process succeed, false if out of memory or the objects could not all be
+ *         placed, in which case the Table is left as it was.
+ */
+static bool cuckooResize(TableP pTable, size_t newSize, bool *outOfMemory)
+{
+    assert(pTable != NULL && newSize > NO_ELEMENTS && outOfMemory != NULL);
+
+    size_t slotSize = pTable -> slotSize;
+    SlotP newSlots = (SlotP)calloc((newSize + CUCKOO_STASH_BUCKETS) * CUCKOO_BUCKET_SLOTS,
+                                   slotSize);
+    *outOfMemory = (newSlots == NULL);
+    if (newSlots == NULL)
+    {
+        return false;
+    }
+
+    // The objects are copied, so the Table is untouched until all of them are placed.
+    size_t stashedElements = NO_ELEMENTS;
+    for (size_t i = INITIAL_INDEX; i < getNumberOfSlots(pTable); i++)
+    {
+        SlotP currentSlot = getSlot(pTable -> slots, slotSize, i);
+        if ((currentSlot -> key) != NULL)
+        {
+            size_t index = cuckooMakeRoom(pTable, newSlots, newSize, currentSlot -> hashCode);
+            if (index == NO_POSITION)
+            {
+                free(newSlots);
+                return false;
+            }
+            copySlot(getSlot(newSlots, slotSize, index), currentSlot, slotSize);
+            stashedElements += (index >= newSize * CUCKOO_BUCKET_SLOTS);
+        }
+    }
+
+    free(pTable -> slots);
+    pTable -> slots = newSlots;
+    pTable -> tableSize = newSize;
+    pTable -> stashedElements = stashedElements;
+    pTable -> shrinkLimit = NO_SHRINK_LIMIT;
+    return true;
+}
+
+/**
+ * @brief Counts the objects of the cuckoo Hash Table whose full Hash Code is the given one,
+ *        which are all in the two Buckets of the Hash Code or in the stash.
+ * @param pTable A pointer to the Hash Table.
+ * @param hashCode The full Hash Code.
+ * @return The number of objects with the Hash Code.
+ */
+static size_t cuckooCountSharedHash(const TableP pTable, HashCode hashCode)
+{
+    assert(pTable != NULL);
+
+    size_t buckets[] = {INITIAL_INDEX, INITIAL_INDEX, pTable -> tableSize};
+    buckets[0] = getCuckooBuckets(hashCode, pTable -> tableSize, &buckets[1]);
+
+    size_t sharedHash = NO_ELEMENTS;
+    for (size_t i = INITIAL_INDEX; i < sizeof(buckets) / sizeof(buckets[0]); i++)
+    {
+        // A Table of a single Bucket has the same two Buckets for every key.
+        if (i > INITIAL_INDEX && buckets[i] == buckets[i - 1])
+        {
+            continue;
+        }
+        for (size_t j = INITIAL_INDEX; j < CUCKOO_BUCKET_SLOTS; j++)
+        {
+            SlotP currentSlot = getSlot(pTable -> slots, pTable -> slotSize,
+                                        buckets[i] * CUCKOO_BUCKET_SLOTS + j);
+            sharedHash += ((currentSlot -> key) != NULL && (currentSlot -> hashCode) == hashCode);
+        }
+    }
+    return sharedHash;
+}
+
+/**
+ * @brief Search the cuckoo Hash Table for the given key, and insert it with the given object if
+ *        it is not found. The Table grows only if no Slot could be freed for the new key, by it's
+ *        Growth Factor and then by it's power, up to CUCKOO_MAX_GROWTHS times.
+ *        Growing does not help a key whose full Hash Code is shared by CUCKOO_MAX_SHARED_HASH
+ *        keys already, such a key reports GENERAL_ERROR, as does a key which is still not
+ *        placed after all the growths. A growth which runs out of memory reports MEM_OUT.
+ * @param pTable A pointer for the Hash Table.
+ * @param key The key to search or insert.
+ * @param hashCode The full Hash Code of the key.
+ * @param object The object to store by the key if it is inserted.
+ * @param found A pointer to update with whether the key was already in the Table.
+ * @return A pointer to the data of the key in it's Slot, or NULL if an error occurred.
+ */
+static DataP *cuckooLookupOrInsert(TableP pTable, const void *key, HashCode hashCode,
+                                   DataP object, bool *found)
+{
+    assert(pTable != NULL && key != NULL && object != NULL && found != NULL);
+
+    size_t index = cuckooFindSlot(pTable, key, hashCode);
+    if (index != NO_POSITION)
+    {
+        *found = true;
+        return &(getSlot(pTable -> slots, pTable -> slotSize, index) -> data);
+    }
+    *found = false;
+
+    if (cuckooCountSharedHash(pTable, hashCode) >= CUCKOO_MAX_SHARED_HASH)
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    index = cuckooMakeRoom(pTable, pTable -> slots, pTable -> tableSize, hashCode);
+    size_t newSize = pTable -> tableSize;
+    for (int i = INITIAL_INDEX; index == NO_POSITION && i < CUCKOO_MAX_GROWTHS; i++)
+    {
+        newSize *= pTable -> growthFactor;
+        bool outOfMemory = false;
+        if (cuckooResize(pTable, newSize, &outOfMemory))
+        {
+            index = cuckooMakeRoom(pTable, pTable -> slots, pTable -> tableSize, hashCode);
+        }
+        else if (outOfMemory)
+        {
+            reportError(MEM_OUT);
+            return NULL;
+        }
+    }
+    if (index == NO_POSITION)
+    {
+        // More memory would not place the key, as the Table is already much sparser than it's
+        // max load factor.
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    SlotP newSlot = getSlot(pTable -> slots, pTable -> slotSize, index);
+    newSlot -> key = storeKey(pTable, key, newSlot -> inlineKey);
+    if ((newSlot -> key) == NULL)
+    {
+        // The cloneKey function already reports of MEM_OUT.
+        return NULL;
+    }
+    newSlot -> data = object;
+    newSlot -> hashCode = hashCode;
+
+    if (index >= (pTable -> tableSize) * CUCKOO_BUCKET_SLOTS)
+    {
+        (pTable -> stashedElements)++;
+    }
+    (pTable -> numberOfElements)++;
+    return &(newSlot -> data);
+}
+
+/**
+ * @brief Move the objects of the stash of the cuckoo Hash Table which have an empty Slot in one
+ *        of their Buckets back to it.
+ * @param pTable A pointer to the Hash Table.
+ */
+static void cuckooUnstash(TableP pTable)
+{
+    assert(pTable != NULL);
+
+    size_t slotSize = pTable -> slotSize;
+    size_t stashIndex = (pTable -> tableSize) * CUCKOO_BUCKET_SLOTS;
+    for (size_t i = INITIAL_INDEX; i < CUCKOO_BUCKET_SLOTS && (pTable -> stashedElements) > NO_ELEMENTS; i++)
+    {
+        SlotP stashedSlot = getSlot(pTable -> slots, slotSize, stashIndex + i);
+        if ((stashedSlot -> key) == NULL)
+        {
+            continue;
+        }
+
+        size_t bucket = INITIAL_INDEX;
+        size_t firstBucket = getCuckooBuckets(stashedSlot -> hashCode, pTable -> tableSize, &bucket);
+        int emptySlot = cuckooFindEmptySlot(pTable, pTable -> slots, firstBucket);
+        if (emptySlot != INVALID_INDEX)
+        {
+            bucket = firstBucket;
+        }
+        else
+        {
+            emptySlot = cuckooFindEmptySlot(pTable, pTable -> slots, bucket);
+        }
+
+        if (emptySlot != INVALID_INDEX)
+        {
+            copySlot(getSlot(pTable -> slots, slotSize, bucket * CUCKOO_BUCKET_SLOTS + (size_t)emptySlot),
+                     stashedSlot, slotSize);
+            stashedSlot -> key = NULL;
+            stashedSlot -> data = NULL;
+            (pTable -> stashedElements)--;
+        }
+    }
+}
+
+/**
+ * @brief Remove the object in the given Slot of the cuckoo Hash Table, without moving any other
+ *        object into the freed Slot.
+ * @param pTable A pointer for the Hash Table to remove from.
+ * @param index The index of the Slot, which holds an object.
+ * @return pointer to the ejected data.
+ */
+static DataP cuckooRemoveSlot(TableP pTable, size_t index)
+{
+    assert(pTable != NULL && index < getNumberOfSlots(pTable));
+
+    SlotP removedSlot = getSlot(pTable -> slots, pTable -> slotSize, index);
+    DataP removedData = removedSlot -> data;
+    releaseKey(removedSlot -> key, removedSlot -> inlineKey, pTable -> freeKey);
+    removedSlot -> key = NULL;
+    removedSlot -> data = NULL;
+    (pTable -> numberOfElements)--;
+
+    if (index >= (pTable -> tableSize) * CUCKOO_BUCKET_SLOTS)
+    {
+        (pTable -> stashedElements)--;
+    }
+    return removedData;
+}
+
+/**
+ * @brief Remove a data from the cuckoo Hash Table. A Slot freed in a Bucket may take back an
+ *        object of the stash.
+ * @param pTable A pointer for the Hash Table to remove from.
+ * @param key The key to remove.
+ * @param hashCode The full Hash Code of the key.
+ * @return pointer to the ejected data if the remove process succeed, otherwise return NULL.
+ */
+static DataP cuckooRemove(TableP pTable, const void *key, HashCode hashCode)
+{
+    assert(pTable != NULL && key != NULL);
+
+    size_t index = cuckooFindSlot(pTable, key, hashCode);
+    if (index == NO_POSITION)
+    {
+        return NULL;
+    }
+
+    DataP removedData = cuckooRemoveSlot(pTable, index);
+    if (index < (pTable -> tableSize) * CUCKOO_BUCKET_SLOTS)
+    {
+        cuckooUnstash(pTable);
+    }
+    return removedData;
+}
+
+/**
+ * @brief Search the cuckoo Hash Table and look for an object with the given key.
+ *        If such object is found fill it's Bucket into arrCell, and it's Slot in the Bucket into
+ *        listNode. An object of the stash is in the cell which follows the last Bucket.
+ * @param pTable A pointer for the Hash Table to search in.
+ * @param key The key to search.
+ * @param hashCode The full Hash Code of the key.
+ * @param arrCell A pointer to update with the proper cell number.
+ * @param listNode A pointer to update with the proper Node placement.
+ * @return A pointer to the data if found, otherwise return NULL.
+ */
+static DataP cuckooFindData(const TableP pTable, const void *key, HashCode hashCode,
+                            size_t *arrCell, size_t *listNode)
+{
+    assert(pTable != NULL && key != NULL && arrCell != NULL && listNode != NULL);
+
+    size_t index = cuckooFindSlot(pTable, key, hashCode);
+    if (index == NO_POSITION)
+    {
+        return NULL;
+    }
+
+    *arrCell = index / CUCKOO_BUCKET_SLOTS;
+    *listNode = index % CUCKOO_BUCKET_SLOTS;
+    return getSlot(pTable -> slots, pTable -> slotSize, index) -> data;
+}
+
+/**
+ * @brief Return the Slot of the cuckoo Hash Table in the given place, if it holds an object.
+ * @param pTable A pointer to the Table.
+ * @param arrCell The Bucket number in the Hash Table, where the stash follows the last Bucket.
+ * @param listNode The placement of the Slot in the Bucket.
+ * @return A pointer to the Slot in the desired place, if it's empty or not exist return NULL.
+ */
+static SlotP cuckooReachSlot(const TableP pTable, size_t arrCell, size_t listNode)
+{
+    assert(pTable != NULL && arrCell <= (pTable -> tableSize));
+
+    if (listNode >= CUCKOO_BUCKET_SLOTS)
+    {
+        return NULL;
+    }
+
+    SlotP pSlot = getSlot(pTable -> slots, pTable -> slotSize,
+                          arrCell * CUCKOO_BUCKET_SLOTS + listNode);
+    return ((pSlot -> key) != NULL) ? pSlot : NULL;
+}
+
+
+/*-----=  Table Functions  =-----*/
+
+
+/**
+ * @brief Generates the Hash Codes of the given key for the given Hash Table, i.e. the full Hash
+ *        Code of the key, which is stored in the Element or Slot of the key, and in a chained
+ *        SPAN_GROWTH Table also the cell of the Hash function for the original size.
+ * @param pTable A pointer to the Hash Table.
+ * @param key A pointer to the key to generate it's Hash Codes.
+ * @param keyHash A pointer to update with the Hash Codes.
+ * @return true if the process succeed, false if the Hash function returned an invalid code.
+ */
+static inline bool generateKeyHash(const TableP pTable, ConstKeyP key, KeyHash *keyHash)
+{
+    assert(pTable != NULL && key != NULL && keyHash != NULL);
+
+    if (!generateFullHashCode(pTable, key, &(keyHash -> fullHashCode)))
+    {
+        return false;
+    }
+
+    keyHash -> originalCell = INITIAL_INDEX;
+    if ((pTable -> engine) != CHAINED_ENGINE || (pTable -> growthMode) != SPAN_GROWTH)
+    {
+        return true;
+    }
+
+    // A 64 bit or seeded Hash function has no cells of it's own, so it's Hash Code is reduced.
+    if ((pTable -> hfun64) != NULL || (pTable -> hashSeeded))
+    {
+        keyHash -> originalCell = reduceHashCode(keyHash -> fullHashCode, pTable -> originalSize);
+        return true;
+    }
+    int originalCell = (pTable -> hfun)(key, pTable -> originalSize);
+    keyHash -> originalCell = (size_t)originalCell;
+    return originalCell >= HASH_CODE_LOWER_BOUND;
+}
+
+/**
+ * @brief Returns the proper HashCode that accustomed to the current size of the given Hash Table
+ *        for the key of the given Hash Codes, i.e. the first cell of the key.
+ *        A rehashed Table reduces the full Hash Code to it's size, and a SPAN_GROWTH Table
+ *        multiplies the original cell by it's size factor.
+ * @param pTable A pointer to the Hash Table.
+ * @param keyHash A pointer to the Hash Codes of the key.
+ * @return The modified HashCode that accustomed to the given Hash Table.
+ */
+static inline size_t getKeyCell(const TableP pTable, const KeyHash *keyHash)
+{
+    assert(pTable != NULL && keyHash != NULL);
+
+    if ((pTable -> engine) == ROBIN_HOOD_ENGINE || (pTable -> growthMode) != SPAN_GROWTH)
+    {
+        return reduceHashCode(keyHash -> fullHashCode, pTable -> tableSize);
+    }
+    return (pTable -> sizeFactor) * (keyHash -> originalCell);
+}
+
+/**
+ * @brief Prefetch the first cell of the key of the given Hash Codes, i.e. it's Bucket or Slot.
+ * @param pTable A pointer to the Hash Table.
+ * @param keyHash A pointer to the Hash Codes of the key.
+ */
+static inline void prefetchKeyCell(const TableP pTable, const KeyHash *keyHash)
+{
+    assert(pTable != NULL && keyHash != NULL);
+
+    size_t cell = getKeyCell(pTable, keyHash);
+    if ((pTable -> engine) == ROBIN_HOOD_ENGINE)
+    {
+        PREFETCH(getSlot(pTable -> slots, pTable -> slotSize, cell));
+    }
+    else if ((pTable -> engine) == CUCKOO_ENGINE)
+    {
+        size_t secondBucket = INITIAL_INDEX;
+        getCuckooBuckets(keyHash -> fullHashCode, pTable -> tableSize, &secondBucket);
+        PREFETCH(getSlot(pTable -> slots, pTable -> slotSize, cell * CUCKOO_BUCKET_SLOTS));
+        PREFETCH(getSlot(pTable -> slots, pTable -> slotSize, secondBucket * CUCKOO_BUCKET_SLOTS));
+    }
+    else
+    {
+        PREFETCH(&((pTable -> table)[cell]));
+    }
+}
+
+/**
+ * @brief Prefetch the first entry in the first cell of the key of the given Hash Codes, i.e. the
+ *        head Element of it's Bucket or the key of it's Slot. The cell should already be cached.
+ *        The Slots of a cuckoo Bucket are already cached with it.
+ * @param pTable A pointer to the Hash Table.
+ * @param keyHash A pointer to the Hash Codes of the key.
+ */
+static inline void prefetchKeyEntry(const TableP pTable, const KeyHash *keyHash)
+{
+    assert(pTable != NULL && keyHash != NULL);
+
+    size_t cell = getKeyCell(pTable, keyHash);
+    if ((pTable -> engine) == CUCKOO_ENGINE)
+    {
+        return;
+    }
+    if ((pTable -> engine) == ROBIN_HOOD_ENGINE)
+    {
+        SlotP pSlot = getSlot(pTable -> slots, pTable -> slotSize, cell);
+        if ((pSlot -> key) != NULL)
+        {
+            PREFETCH(pSlot -> key);
+        }
+    }
+    else if ((pTable -> table)[cell].head != NULL)
+    {
+        PREFETCH((pTable -> table)[cell].head);
+    }
+}
+
+/**
+ * @brief Generate the Hash Codes of a group of keys of a batch, and prefetch their cells and then
+ *        their first entries, so the cache misses of the whole group overlap instead of each
+ *        operation waiting for it's own.
+ * @param pTable A pointer to the Hash Table.
+ * @param keys The keys of the group.
+ * @param groupSize The number of keys in the group, up to BATCH_GROUP_SIZE.
+ * @param keyHashes The array to update with the Hash Codes of the keys.
+ * @param hashed The array to update with whether each key is valid and was hashed.
+ */
+static void prepareKeyGroup(const TableP pTable, const void *const *keys, size_t groupSize,
+                            KeyHash *keyHashes, bool *hashed)
+{
+    assert(pTable != NULL && keys != NULL && keyHashes != NULL && hashed != NULL);
+    assert(groupSize <= BATCH_GROUP_SIZE);
+
+    for (size_t i = INITIAL_INDEX; i < groupSize; i++)
+    {
+        hashed[i] = keys[i] != NULL && generateKeyHash(pTable, keys[i], &keyHashes[i]);
+        if (hashed[i])
+        {
+            prefetchKeyCell(pTable, &keyHashes[i]);
+        }
+    }
+    for (size_t i = INITIAL_INDEX; i < groupSize; i++)
+    {
+        if (hashed[i])
+        {
+            prefetchKeyEntry(pTable, &keyHashes[i]);
+        }
+    }
+}
+
+/**
+ * @brief Returns the number of consecutive cells, starting at the HashCode of a key,
+ *        in which the Element of this key may be stored.
+ * @param pTable A pointer to the Hash Table.
+ * @return The number of cells to scan for a single key.
+ */
+static inline size_t getProbeSpan(TableP pTable)
+{
+    assert(pTable != NULL);
+
+    if ((pTable -> growthMode) != SPAN_GROWTH)
+    {
+        // A rehashed Table always holds each key in a single cell.
+        return INITIAL_SIZE_FACTOR;
+    }
+    return pTable -> sizeFactor;
+}
+
+/**
+ * @brief Updates the current size factor for the given Hash Table.
+ *        The size factor is the number in which the original table size was multiplied, i.e.
+ *        the product of the factors of all the times we resize the Table.
+ * @param pTable A pointer to the Hash Table to update.
+ * @param resizeFactor The number in which the table size is multiplied by this resize.
+ */
+static inline void updateSizeFactor(TableP pTable, size_t resizeFactor)
+{
+    assert(pTable != NULL);
+    pTable -> sizeFactor *= resizeFactor;
+}
+
+/**
+ * @brief Insert a new Element with the given key and object to the end of the given Bucket
+ *        of the Hash Table. The key is stored inline in the Element if it fits, otherwise
+ *        it is cloned.
+ * @param pTable A pointer to the Hash Table to insert to.
+ * @param pBucket A pointer to the Bucket of the Hash Table to insert to.
+ * @param key The key to insert.
+ * @param hashCode The full Hash Code of the key.
+ * @param object The object that is stored by the given key.
+ * @return A pointer to the new Element if the process succeed, NULL if out of memory.
+ */
+static ElementP tableInsertElement(TableP pTable, BucketP pBucket, const void *key,
+                                   HashCode hashCode, DataP object)
+{
+    assert(pTable != NULL && pBucket != NULL && key != NULL && object != NULL);
+
+    ElementP newElement = (ElementP)poolAllocate(pTable -> elementPool);
+    if (newElement == NULL)
+    {
+        reportError(MEM_OUT);
+        return NULL;
+    }
+
+    newElement -> key = storeKey(pTable, key, newElement -> inlineKey);
+    if ((newElement -> key) == NULL)
+    {
+        // The cloneKey function already reports of MEM_OUT.
+        poolRelease(pTable -> elementPool, newElement);
+        return NULL;
+    }
+    newElement -> data = object;
+    newElement -> hashCode = hashCode;
+    bucketAppendElement(pBucket, newElement);
+
+    (pTable -> numberOfElements)++;
+    return newElement;
+}
+
+/**
+ * @brief Allocate the cells of the given Hash Table according to it's engine, i.e.
+ *        an empty Bucket in each cell for a chained Table, an empty Slot in each cell for
+ *        a Robin Hood Table, or a Bucket of empty Slots in each cell for a cuckoo Table.
+ * @param pTable A pointer to the Hash Table, with it's size and engine already set.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool allocateTableCells(TableP pTable)
+{
+    assert(pTable != NULL);
+
+    pTable -> table = NULL;
+    pTable -> slots = NULL;
+    pTable -> spareSlots = NULL;
+    pTable -> stashedElements = NO_ELEMENTS;
+
+    if ((pTable -> engine) != CHAINED_ENGINE)
+    {
+        pTable -> slotSize = sizeof(Slot) + getInlineStorageSize(pTable -> inlineKeySize);
+        pTable -> slots = (SlotP)calloc(getNumberOfSlots(pTable), pTable -> slotSize);
+        if ((pTable -> engine) == ROBIN_HOOD_ENGINE)
+        {
+            pTable -> spareSlots = (SlotP)calloc(NUMBER_OF_SPARE_SLOTS, pTable -> slotSize);
+        }
+        if ((pTable -> slots) == NULL
+            || ((pTable -> engine) == ROBIN_HOOD_ENGINE && (pTable -> spareSlots) == NULL))
+        {
+            free(pTable -> slots);
+            pTable -> slots = NULL;
+            free(pTable -> spareSlots);
+            pTable -> spareSlots = NULL;
+            return false;
+        }
+        return true;
+    }
+
+    // All the Buckets of the Table are allocated at once, and start empty.
+    pTable -> table = (BucketP)calloc(pTable -> tableSize, sizeof(Bucket));
+    return (pTable -> table) != NULL;
+}
+
+/**
+ * @brief Create the Memory Pool of the Elements of a chained Hash Table, which takes it's
+ *        slabs from the user arena if one was given.
+ * @param pTable A pointer to the Hash Table.
+ * @param options A pointer for the options of the Hash Table.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool createElementPool(TableP pTable, const TableOptions *options)
+{
+    assert(pTable != NULL && options != NULL);
+
+    pTable -> elementPool = NULL;
+    if ((pTable -> engine) != CHAINED_ENGINE)
+    {
+        return true;
+    }
+
+    size_t elementSize = sizeof(Element) + getInlineStorageSize(options -> inlineKeySize);
+    pTable -> elementPool = createMemoryPool(elementSize, options -> arenaAlloc,
+                                             options -> arenaFree, options -> arena);
+    return (pTable -> elementPool) != NULL;
+}
+
+/**
+ * @brief Frees the keys held by the given cells of the Hash Table.
+ *        The Elements themselves are released with their Memory Pool.
+ * @param pTable A pointer to the Hash Table.
+ * @param cells The cells to free their keys.
+ * @param numberOfCells The number of cells.
+ */
+static void freeCellsKeys(TableP pTable, BucketP cells, size_t numberOfCells)
+{
+    assert(pTable != NULL && cells != NULL);
+
+    if ((pTable -> keyArena) != NULL)
+    {
+        // The keys are released with their Key Arena, so the Elements are not visited.
+        return;
+    }
+    for (size_t i = INITIAL_INDEX; i < numberOfCells; i++)
+    {
+        for (ElementP pElement = cells[i].head; pElement != NULL; pElement = pElement -> next)
+        {
+            releaseKey(pElement -> key, pElement -> inlineKey, pTable -> freeKey);
+        }
+    }
+}
+
+/**
+ * @brief Returns the max load factor of a Hash Table with the given options, which is the
+ *        default of the engine if the options do not set one.
+ * @param options A pointer to the options of the Hash Table.
+ * @return The max load factor.
+ */
+static double getMaxLoadFactor(const TableOptions *options)
+{
+    assert(options != NULL);
+
+    if ((options -> maxLoadFactor) != ENGINE_LOAD_FACTOR)
+    {
+        return options -> maxLoadFactor;
+    }
+    if ((options -> engine) == ROBIN_HOOD_ENGINE)
+    {
+        return ROBIN_HOOD_MAX_LOAD;
+    }
+    if ((options -> engine) == CUCKOO_ENGINE)
+    {
+        return CUCKOO_MAX_LOAD;
+    }
+    return CHAINED_MAX_LOAD;
+}
+
+/**
+ * @brief Free the Key Arena of the given Hash Table, with all of it's keys, if the Table owns it.
+ *        A shared Key Arena is left to the user.
+ * @param pTable A pointer to the Hash Table.
+ */
+static void releaseKeyArena(TableP pTable)
+{
+    assert(pTable != NULL);
+
+    if (pTable -> ownsKeyArena)
+    {
+        freeKeyArena(pTable -> keyArena);
+        pTable -> keyArena = NULL;
+    }
+}
+
+/**
+ * @brief Checks whether a Hash Table with the given options uses it's seeded Hash function
+ *        from the start, which a Robin Hood or cuckoo Table always does.
+ * @param options A pointer for the options of the Hash Table.
+ * @return true if the Table is seeded from the start, false otherwise.
+ */
+static inline bool isSeededFromStart(const TableOptions *options)
+{
+    assert(options != NULL);
+
+    return (options -> seededHfun) != NULL
+           && ((options -> engine) != CHAINED_ENGINE
+               || (options -> floodChainLength) == SEEDED_FROM_START);
+}
+
+/**
+ * @brief Initialize a new Hash Table with the given table size.
+ *        The function allocated memory for the new Hash Table, if the allocation was failed at
+ *        some point, the function will free all the memory that was already allocated
+ *        and will return a NULL pointer.
+ * @param tableSize The size of the Hash Table to set.
+ * @param options A pointer for the options of the Hash Table.
+ * @param cloneKey A pointer for the Key Cloning function.
+ * @param freeKey A pointer for the Free Key function.
+ * @param hfun A pointer for the Hash function, or NULL if the options hold a 64 bit one or a
+ *        seeded one which is used from the start.
+ * @param printKeyFun A pointer for the Print Key function.
+ * @param printDataFun A pointer for the Print Data function.
+ * @param fcomp A pointer for the Key Comparison function.
+ * @return A pointer for the new initialized Hash Table, or NULL if the process failed.
+ */
+static TableP initializeTable(size_t tableSize, const TableOptions *options, CloneKeyFcn cloneKey,
+                              FreeKeyFcn freeKey, HashFcn hfun, PrintKeyFcn printKeyFun,
+                              PrintDataFcn printDataFun, ComparisonFcn fcomp)
+{
+    assert(options != NULL);
+    assert(cloneKey != NULL && freeKey != NULL
+           && (hfun != NULL || (options -> hfun64) != NULL || isSeededFromStart(options))
+           && printKeyFun != NULL && printDataFun != NULL && fcomp != NULL);
+
+    TableP pTable = NULL;
+
+    pTable = (TableP)malloc(sizeof(Table));
+    // We continue the process only if the allocation for memory succeed.
+    if (pTable != NULL)
+    {
+        pTable -> engine = options -> engine;
+        pTable -> tableSize = tableSize;
+        pTable -> originalSize = tableSize;
+        pTable -> sizeFactor = INITIAL_SIZE_FACTOR;
+        pTable -> numberOfElements = NO_ELEMENTS;
+        pTable -> growthMode = options -> growthMode;
+        pTable -> bucketCapacity = options -> bucketCapacity;
+        pTable -> maxLoadFactor = getMaxLoadFactor(options);
+        pTable -> growthFactor = options -> growthFactor;
+        pTable -> minLoadFactor = options -> minLoadFactor;
+        pTable -> shrinkLimit = NO_SHRINK_LIMIT;
+        pTable -> oldTable = NULL;
+        pTable -> oldSize = NO_ELEMENTS;
+        pTable -> migrationIndex = INITIAL_INDEX;
+        pTable -> floodChainLength = options -> floodChainLength;
+        pTable -> resizeThreads = options -> resizeThreads;
+        pTable -> hashSeeded = isSeededFromStart(options);
+        if (pTable -> hashSeeded)
+        {
+            generateHashSeed(&(pTable -> hashSeed), pTable);
+        }
+
+        // Assign the given functions to the Hash Table.
+        pTable -> cloneKey = cloneKey;
+        pTable -> freeKey = freeKey;
+        pTable -> hfun = hfun;
+        pTable -> hfun64 = options -> hfun64;
+        pTable -> seededHfun = options -> seededHfun;
+        pTable -> printKeyFun = printKeyFun;
+        pTable -> printDataFun = printDataFun;
+        pTable -> fcomp = fcomp;
+        pTable -> inlineKeySize = options -> inlineKeySize;
+        pTable -> keySize = options -> keySize;
+        pTable -> keyArena = options -> keyArena;
+        pTable -> ownsKeyArena = (options -> keyArena) == NULL && (options -> arenaKeys);
+        if (pTable -> ownsKeyArena)
+        {
+            pTable -> keyArena = createKeyArena(options -> internKeys);
+        }
+        if ((pTable -> keyArena) != NULL)
+        {
+            pTable -> freeKey = keepArenaKey;
+        }
+
+        if ((pTable -> ownsKeyArena) && (pTable -> keyArena) == NULL)
+        {
+            // If memory allocation failed, we free all the memory that was already allocated.
+            free(pTable);
+            pTable = NULL;
+        }
+        else if (!createElementPool(pTable, options))
+        {
+            // If memory allocation failed, we free all the memory that was already allocated.
+            releaseKeyArena(pTable);
+            free(pTable);
+            pTable = NULL;
+        }
+        else if (!allocateTableCells(pTable))
+        {
+            // If memory allocation failed, we free all the memory that was already allocated.
+            freeMemoryPool(pTable -> elementPool);
+            releaseKeyArena(pTable);
+            free(pTable);
+            pTable = NULL;
+        }
+    }
+    return pTable;
+}
+
+/**
+ * @brief Move the Elements of the given range of cells of the old Table into the given new
+ *        Table, placing each Element in the cell that it's full Hash Code gives for the new size.
+ * @param range A pointer to the range of cells.
+ */
+static void rehashCellRange(const RehashRange *range)
+{
+    assert(range != NULL);
+
+    for (size_t i = range -> firstCell; i < (range -> endCell); i++)
+    {
+        ElementP currentElement = (range -> oldTable)[i].head;
+        while (currentElement != NULL)
+        {
+            ElementP nextElement = currentElement -> next;
+
+            size_t hashCode = reduceHashCode(currentElement -> hashCode, range -> newSize);
+            bucketAppendElement(&((range -> newTable)[hashCode]), currentElement);
+
+            currentElement = nextElement;
+        }
+    }
+}
+
+/**
+ * @brief The start routine of a thread of a parallel resize.
+ * @param range A pointer to the range of cells of the thread.
+ * @return NULL.
+ */
+static void *rehashRangeThread(void *range)
+{
+    rehashCellRange((const RehashRange *)range);
+    return NULL;
+}
+
+/**
+ * @brief Run the given routine on each of the given tasks at once, each task on a thread of it's
+ *        own and the first task on the calling thread, and wait for all of them to end.
+ *        A task whose thread could not start runs on the calling thread, so every task is run.
+ * @param tasks The array of tasks.
+ * @param taskSize The size of a single task in bytes.
+ * @param numberOfTasks The number of tasks, at least 1.
+ * @param routine The routine that runs a single task.
+ */
+static void runThreadTasks(void *tasks, size_t taskSize, size_t numberOfTasks,
+                           void *(*routine)(void *))
+{
+    assert(tasks != NULL && numberOfTasks > NO_ELEMENTS && routine != NULL);
+
+    pthread_t *threads = (pthread_t *)malloc(numberOfTasks * sizeof(pthread_t));
+    bool *started = (bool *)calloc(numberOfTasks, sizeof(bool));
+    if (threads != NULL && started != NULL)
+    {
+        for (size_t i = INITIAL_INDEX + 1; i < numberOfTasks; i++)
+        {
+            started[i] = pthread_create(&threads[i], NULL, routine,
+                                        (char *)tasks + i * taskSize) == THREAD_SUCCESS;
+        }
+    }
+
+    for (size_t i = INITIAL_INDEX; i < numberOfTasks; i++)
+    {
+        if (started != NULL && started[i])
+        {
+            pthread_join(threads[i], NULL);
+        }
+        else
+        {
+            routine((char *)tasks + i * taskSize);
+        }
+    }
+    free(threads);
+    free(started);
+}
+
+/**
+ * @brief Returns the number of threads which rehash the Hash Table into the given size.
+ *        The Elements of an old cell all move to the growth factor cells that start at the old
+ *        cell times the growth factor, as long as the new size is a multiple of the current
+ *        one and the Hash Codes are reduced by scaling, so threads which rehash separate ranges
+ *        of old cells never write the same Bucket. Any other resize runs on a single thread.
+ * @param pTable A pointer to the Hash Table.
+ * @param newSize The size of the new Table.
+ * @return The number of threads, at least 1.
+ */
+static size_t getRehashThreads(const TableP pTable, size_t newSize)
+{
+    assert(pTable != NULL);
+
+    size_t currentSize = pTable -> tableSize;
+    if ((pTable -> resizeThreads) <= SERIAL_RESIZE || newSize <= currentSize
+        || newSize % currentSize != NO_ELEMENTS
+        || (uint64_t)newSize > ((uint64_t)1 << HASH_REDUCTION_SHIFT))
+    {
+        return SERIAL_RESIZE;
+    }
+
+    size_t numberOfThreads = currentSize / MIN_CELLS_PER_RESIZE_THREAD;
+    if (numberOfThreads > (pTable -> resizeThreads))
+    {
+        numberOfThreads = pTable -> resizeThreads;
+    }
+    return (numberOfThreads > SERIAL_RESIZE) ? numberOfThreads : SERIAL_RESIZE;
+}
+
+/**
+ * @brief Move all the Elements of the Hash Table into the given new Table, placing each Element
+ *        in the cell that it's full Hash Code gives for the new size.
+ *        The Elements are relinked, so no memory is allocated and no key is hashed during the
+ *        process. A large Table that grows is split to ranges of cells, which are rehashed by
+ *        up to resizeThreads threads, the calling thread among them.
+ * @param pTable A pointer to the Hash Table to rehash.
+ * @param newTable The new Table, with an empty Bucket in each cell.
+ * @param newSize The size of the new Table.
+ */
+static void rehashElements(TableP pTable, BucketP newTable, size_t newSize)
+{
+    assert(pTable != NULL && newTable != NULL);
+
+    size_t numberOfThreads = getRehashThreads(pTable, newSize);
+    RehashRange *ranges = NULL;
+    if (numberOfThreads > SERIAL_RESIZE)
+    {
+        ranges = (RehashRange *)malloc(numberOfThreads * sizeof(RehashRange));
+    }
+    if (ranges == NULL)
+    {
+        RehashRange fullRange = {pTable -> table, newTable, newSize, INITIAL_INDEX,
+                                 pTable -> tableSize};
+        rehashCellRange(&fullRange);
+        return;
+    }
+
+    for (size_t i = INITIAL_INDEX; i < numberOfThreads; i++)
+    {
+        ranges[i].oldTable = pTable -> table;
+        ranges[i].newTable = newTable;
+        ranges[i].newSize = newSize;
+        ranges[i].firstCell = (pTable -> tableSize) / numberOfThreads * i;
+        ranges[i].endCell = (i + 1 == numberOfThreads) ? (pTable -> tableSize) :
+                            (pTable -> tableSize) / numberOfThreads * (i + 1);
+    }
+    runThreadTasks(ranges, sizeof(RehashRange), numberOfThreads, rehashRangeThread);
+    free(ranges);
+}
+
+/**
+ * @brief Move the Elements of a single old cell of an incremental resize into their cells in
+ *        the current Table. The Elements are relinked, so the process can not fail.
+ * @param pTable A pointer to the Hash Table.
+ * @param oldCell The cell number in the old Table.
+ */
+static void migrateOldCell(TableP pTable, size_t oldCell)
+{
+    assert(pTable != NULL && (pTable -> oldTable) != NULL && oldCell < (pTable -> oldSize));
+
+    BucketP oldBucket = &((pTable -> oldTable)[oldCell]);
+    while ((oldBucket -> head) != NULL)
+    {
+        ElementP pElement = oldBucket -> head;
+        size_t hashCode = reduceHashCode(pElement -> hashCode, pTable -> tableSize);
+
+        oldBucket -> head = pElement -> next;
+        (oldBucket -> numberOfElements)--;
+        bucketAppendElement(&((pTable -> table)[hashCode]), pElement);
+    }
+}
+
+/**
+ * @brief Move up to the given number of old cells of an incremental resize into the current
+ *        Table, and release the old Table once all of it's cells were moved.
+ * @param pTable A pointer to the Hash Table.
+ * @param numberOfCells The max number of old cells to move.
+ */
+static void migrateOldCells(TableP pTable, size_t numberOfCells)
+{
+    assert(pTable != NULL);
+
+    while ((pTable -> oldTable) != NULL && numberOfCells > NO_ELEMENTS)
+    {
+        migrateOldCell(pTable, pTable -> migrationIndex);
+        (pTable -> migrationIndex)++;
+        numberOfCells--;
+
+        if ((pTable -> migrationIndex) == (pTable -> oldSize))
+        {
+            free(pTable -> oldTable);
+            pTable -> oldTable = NULL;
+            pTable -> oldSize = NO_ELEMENTS;
+            pTable -> migrationIndex = INITIAL_INDEX;
+        }
+    }
+}
+
+/**
+ * @brief Start an incremental resize of the Hash Table. The current cells become the old Table,
+ *        and a new Table of empty cells becomes the current one, so the cost of the resize
+ *        does not depend on the number of Elements.
+ * @param pTable A pointer to the Hash Table to resize.
+ * @param newSize The size of the new Table.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool startIncrementalResize(TableP pTable, size_t newSize)
+{
+    assert(pTable != NULL && (pTable -> oldTable) == NULL);
+
+    BucketP newTable = (BucketP)calloc(newSize, sizeof(Bucket));
+    if (newTable == NULL)
+    {
+        return false;
+    }
+
+    pTable -> oldTable = pTable -> table;
+    pTable -> oldSize = pTable -> tableSize;
+    pTable -> migrationIndex = INITIAL_INDEX;
+    pTable -> table = newTable;
+    pTable -> tableSize = newSize;
+    pTable -> shrinkLimit = NO_SHRINK_LIMIT;
+    return true;
+}
+
+/**
+ * @brief Search the cell of the old Table that may still hold the given key, during an
+ *        incremental resize.
+ * @param pTable A pointer for the Hash Table to search in.
+ * @param key The key to search.
+ * @param fullHashCode The full Hash Code of the key.
+ * @param pBucket A pointer to update with the Bucket of the key.
+ * @param arrCell A pointer to update with the proper cell number.
+ * @param listNode A pointer to update with the proper Node placement.
+ * @return The link to the Element of the key if found, otherwise return NULL.
+ */
+static ElementP *findInOldTable(const TableP pTable, ConstKeyP key, HashCode fullHashCode,
+                                BucketP *pBucket, size_t *arrCell, size_t *listNode)
+{
+    assert(pTable != NULL && key != NULL && pBucket != NULL);
+    assert(arrCell != NULL && listNode != NULL);
+
+    if ((pTable -> oldTable) == NULL)
+    {
+        return NULL;
+    }
+
+    size_t hashCode = reduceHashCode(fullHashCode, pTable -> oldSize);
+    BucketP oldBucket = &((pTable -> oldTable)[hashCode]);
+    ElementP *link = bucketFindLink(oldBucket, key, fullHashCode, listNode, pTable -> fcomp);
+    if (link != NULL)
+    {
+        *pBucket = oldBucket;
+        *arrCell = (pTable -> tableSize) + hashCode;
+    }
+    return link;
+}
+
+/**
+ * @brief Search the chained Hash Table for the Element of the given key, whose Hash Codes
+ *        were already generated. Each search also moves a few old cells of an incremental resize.
+ * @param pTable A pointer for the Hash Table to search in.
+ * @param key The key to search.
+ * @param hashCode The HashCode of the key, accustomed to the Hash Table.
+ * @param fullHashCode The full Hash Code of the key.
+ * @param pBucket A pointer to update with the Bucket of the key.
+ * @param arrCell A pointer to update with the proper cell number.
+ * @param listNode A pointer to update with the proper Node placement.
+ * @return The link to the Element of the key if found, i.e. the head of it's Bucket or the next
+ *         pointer of the previous Element, otherwise return NULL.
+ */
+static ElementP *chainedFindLink(const TableP pTable, ConstKeyP key, size_t hashCode,
+                                 HashCode fullHashCode, BucketP *pBucket, size_t *arrCell,
+                                 size_t *listNode)
+{
+    assert(pTable != NULL && key != NULL && pBucket != NULL);
+    assert(arrCell != NULL && listNode != NULL);
+    assert(hashCode < (pTable -> tableSize));
+
+    // Every insert and removeData passes here, so each operation moves a few old cells.
+    migrateOldCells(pTable, INCREMENTAL_MIGRATION_STEP);
+    ElementP *link = findInOldTable(pTable, key, fullHashCode, pBucket, arrCell, listNode);
+    if (link != NULL)
+    {
+        return link;
+    }
+
+    // Iterate through the possible Buckets to search.
+    for (size_t i = INITIAL_INDEX; i < getProbeSpan(pTable); i++)
+    {
+        // Find the proper Bucket to search the key.
+        BucketP currentBucket = &((pTable -> table)[hashCode + i]);
+
+        // Search inside the current Bucket.
+        link = bucketFindLink(currentBucket, key, fullHashCode, listNode, pTable -> fcomp);
+        if (link != NULL)
+        {
+            *pBucket = currentBucket;
+            *arrCell = hashCode + i;
+            break;
+        }
+    }
+    return link;
+}
+
+/**
+ * @brief Checks whether the Elements of each original cell of a SPAN_GROWTH Hash Table would fit
+ *        in the Buckets of it's cells with the given size factor.
+ * @param pTable A pointer to the Hash Table.
+ * @param newSizeFactor The size factor to check.
+ * @return true if the Elements fit, false otherwise.
+ */
+static bool spanElementsFit(const TableP pTable, size_t newSizeFactor)
+{
+    assert(pTable != NULL && (pTable -> growthMode) == SPAN_GROWTH);
+
+    size_t sizeFactor = (size_t)(pTable -> sizeFactor);
+    size_t spanCapacity = newSizeFactor * (pTable -> bucketCapacity);
+    for (size_t cell = INITIAL_INDEX; cell < (pTable -> originalSize); cell++)
+    {
+        size_t spanElements = NO_ELEMENTS;
+        for (size_t i = INITIAL_INDEX; i < sizeFactor; i++)
+        {
+            spanElements += (pTable -> table)[cell * sizeFactor + i].numberOfElements;
+        }
+        if (spanElements > spanCapacity)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Move the Elements of a SPAN_GROWTH Hash Table into the given smaller Table, filling the
+ *        Buckets of each original cell one after the other, so it's probing span gets shorter.
+ *        The Elements must fit, as checked by spanElementsFit.
+ * @param pTable A pointer to the Hash Table to shrink.
+ * @param newTable The new Table, with an empty Bucket in each cell.
+ * @param newSizeFactor The size factor of the new Table.
+ */
+static void repackSpanElements(TableP pTable, BucketP newTable, size_t newSizeFactor)
+{
+    assert(pTable != NULL && newTable != NULL);
+
+    size_t sizeFactor = (size_t)(pTable -> sizeFactor);
+    for (size_t cell = INITIAL_INDEX; cell < (pTable -> originalSize); cell++)
+    {
+        BucketP newBucket = &newTable[cell * newSizeFactor];
+        for (size_t i = INITIAL_INDEX; i < sizeFactor; i++)
+        {
+            ElementP currentElement = (pTable -> table)[cell * sizeFactor + i].head;
+            while (currentElement != NULL)
+            {
+                ElementP nextElement = currentElement -> next;
+                if ((newBucket -> numberOfElements) == (pTable -> bucketCapacity))
+                {
+                    newBucket++;
+                }
+                bucketAppendElement(newBucket, currentElement);
+                currentElement = nextElement;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Rebuild the Hash Table at once in the given size and allocate the current Elements in
+ *        the updated cells in the Table. An incremental resize must not be in progress.
+ *        In SPAN_GROWTH the new size must be the original size times a whole size factor.
+ *        A growing Table keeps the order of it's Buckets, and a shrinking one packs the Elements
+ *        of each original cell into it's fewer cells, if they fit. Otherwise each Element is
+ *        moved to the cell of it's key in the new size, which may also be smaller than the
+ *        current one.
+ * @param pTable A pointer to the Hash Table to rebuild.
+ * @param newSize The new size of the Hash Table.
+ * @return true if the process succeed, false if out of memory or the Elements do not fit.
+ */
+static bool rebuildTable(TableP pTable, size_t newSize)
+{
+    assert(pTable != NULL && (pTable -> oldTable) == NULL);
+
+    size_t currentSize = (pTable -> tableSize);
+    size_t newSizeFactor = newSize / (pTable -> originalSize);
+    assert((pTable -> growthMode) != SPAN_GROWTH
+           || newSize == newSizeFactor * (pTable -> originalSize));
+    if ((pTable -> growthMode) == SPAN_GROWTH && newSize < currentSize
+        && !spanElementsFit(pTable, newSizeFactor))
+    {
+        return false;
+    }
+
+    // All the Buckets of the new Table are allocated at once, and start empty.
+    BucketP newTable = (BucketP)calloc(newSize, sizeof(Bucket));
+    if (newTable == NULL)
+    {
+        return false;
+    }
+
+    if ((pTable -> growthMode) != SPAN_GROWTH)
+    {
+        rehashElements(pTable, newTable, newSize);
+    }
+    else if (newSize < currentSize)
+    {
+        repackSpanElements(pTable, newTable, newSizeFactor);
+        pTable -> sizeFactor = newSizeFactor;
+    }
+    else
+    {
+        size_t resizeFactor = newSize / currentSize;
+        for (size_t i = INITIAL_INDEX; i < currentSize; i++)
+        {
+            newTable[i * resizeFactor] = (pTable -> table)[i];
+        }
+        updateSizeFactor(pTable, resizeFactor);
+    }
+
+    // Update the Hash Table size.
+    (pTable -> tableSize) = newSize;
+
+    // Release the old Table.
+    free(pTable -> table);
+    pTable -> table = newTable;
+    pTable -> shrinkLimit = NO_SHRINK_LIMIT;
+    return true;
+}
+
+/**
+ * @brief Resize the Hash Table to the given size. An INCREMENTAL_GROWTH Table starts an
+ *        incremental resize, and any other Table is rebuilt at once.
+ * @param pTable A pointer to the Hash Table to resize.
+ * @param newSize The new size of the Hash Table.
+ * @return true if the process succeed, false otherwise.
+ */
+static bool resizeTable(TableP pTable, size_t newSize)
+{
+    assert(pTable != NULL);
+
+    if ((pTable -> growthMode) == INCREMENTAL_GROWTH)
+    {
+        return startIncrementalResize(pTable, newSize);
+    }
+    return rebuildTable(pTable, newSize);
+}
+
+/**
+ * @brief Returns the size the Hash Table should have to hold the given number of objects
+ *        without growing, i.e. the given size multiplied by the Growth Factor until the
+ *        objects do not pass the max load factor.
+ * @param pTable A pointer to the Hash Table.
+ * @param fromSize The size to start from.
+ * @param expectedElements The number of objects the Table should hold.
+ * @return The size of the Table, or 0 if the size is too large for the cell numbers, which
+ *         are int Hash Codes for a Table with neither a 64 bit nor a seeded Hash function.
+ */
+static size_t getReservedSize(const TableP pTable, size_t fromSize, size_t expectedElements)
+{
+    assert(pTable != NULL);
+
+    // Only the cells of a plain Hash function must fit it's int Hash Codes.
+    size_t maxSize = SIZE_MAX;
+    if ((pTable -> hfun64) == NULL && (pTable -> seededHfun) == NULL)
+    {
+        maxSize = (size_t)INT_MAX;
+    }
+
+    size_t newSize = fromSize;
+    while ((double)expectedElements > (pTable -> maxLoadFactor) * newSize)
+    {
+        if (newSize > maxSize / (pTable -> growthFactor))
+        {
+            return NO_ELEMENTS;
+        }
+        newSize *= pTable -> growthFactor;
+    }
+    return newSize;
+}
+
+/**
+ * @brief Resize the Slots of a Robin Hood or cuckoo Hash Table to the given size.
+ * @param pTable A pointer to the Hash Table to resize.
+ * @param newSize The new size of the Hash Table.
+ * @return true if the process succeed, false otherwise.
+ */
+static bool resizeSlots(TableP pTable, size_t newSize)
+{
+    assert(pTable != NULL && (pTable -> engine) != CHAINED_ENGINE);
+
+    if ((pTable -> engine) == CUCKOO_ENGINE)
+    {
+        bool outOfMemory = false;
+        return cuckooResize(pTable, newSize, &outOfMemory);
+    }
+    return robinHoodResize(pTable, newSize);
+}
+
+/**
+ * @brief Grow the Hash Table at once, so the given number of objects would be inserted to it
+ *        without any resize. An incremental resize in progress is completed first.
+ * @param pTable A pointer to the Hash Table.
+ * @param newSize The size to grow to, as given by getReservedSize.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool reserveCells(TableP pTable, size_t newSize)
+{
+    assert(pTable != NULL && newSize >= (pTable -> tableSize));
+
+    if (newSize == (pTable -> tableSize))
+    {
+        return true;
+    }
+    if ((pTable -> engine) != CHAINED_ENGINE)
+    {
+        return resizeSlots(pTable, newSize);
+    }
+
+    migrateOldCells(pTable, pTable -> oldSize);
+    return rebuildTable(pTable, newSize);
+}
+
+/**
+ * @brief Switch the chained Hash Table to it's seeded Hash function under a new random seed, and
+ *        move each Element to the cell of it's new Hash Code. An incremental resize in progress
+ *        is completed first. A SPAN_GROWTH Table, whose cells follow the original Hash function,
+ *        becomes a REHASH_GROWTH Table sized for it's Elements from it's original size.
+ *        If run out of memory, the Table is left as it was.
+ * @param pTable A pointer to the Hash Table to seed.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool seedTableHash(TableP pTable)
+{
+    assert(pTable != NULL && (pTable -> engine) == CHAINED_ENGINE);
+    assert((pTable -> seededHfun) != NULL && !(pTable -> hashSeeded));
+
+    migrateOldCells(pTable, pTable -> oldSize);
+    size_t newSize = pTable -> tableSize;
+    if ((pTable -> growthMode) == SPAN_GROWTH)
+    {
+        newSize = getReservedSize(pTable, pTable -> originalSize, pTable -> numberOfElements);
+        newSize = (newSize == NO_ELEMENTS) ? (pTable -> tableSize) : newSize;
+    }
+
+    BucketP newTable = (BucketP)calloc(newSize, sizeof(Bucket));
+    if (newTable == NULL)
+    {
+        return false;
+    }
+
+    generateHashSeed(&(pTable -> hashSeed), pTable);
+    for (size_t i = INITIAL_INDEX; i < (pTable -> tableSize); i++)
+    {
+        ElementP currentElement = (pTable -> table)[i].head;
+        while (currentElement != NULL)
+        {
+            ElementP nextElement = currentElement -> next;
+
+            currentElement -> hashCode = (pTable -> seededHfun)(currentElement -> key,
+                                                                &(pTable -> hashSeed));
+            size_t hashCode = reduceHashCode(currentElement -> hashCode, newSize);
+            bucketAppendElement(&newTable[hashCode], currentElement);
+
+            currentElement = nextElement;
+        }
+    }
+
+    free(pTable -> table);
+    pTable -> table = newTable;
+    pTable -> tableSize = newSize;
+    pTable -> hashSeeded = true;
+    if ((pTable -> growthMode) == SPAN_GROWTH)
+    {
+        pTable -> growthMode = REHASH_GROWTH;
+        pTable -> sizeFactor = INITIAL_SIZE_FACTOR;
+    }
+    pTable -> shrinkLimit = NO_SHRINK_LIMIT;
+    return true;
+}
+
+/**
+ * @brief Shrink the Hash Table by it's Growth Factor. If the Table can not shrink, either since
+ *        the Elements of a SPAN_GROWTH Table do not fit or since run out of memory, it keeps
+ *        it's size, and does not try again until the number of it's objects falls again by
+ *        the Growth Factor.
+ * @param pTable A pointer to the Hash Table to shrink.
+ */
+static void shrinkTable(TableP pTable)
+{
+    assert(pTable != NULL);
+
+    size_t newSize = (pTable -> tableSize) / (pTable -> growthFactor);
+    bool shrunk = false;
+    if ((pTable -> engine) != CHAINED_ENGINE)
+    {
+        shrunk = resizeSlots(pTable, newSize);
+    }
+    else
+    {
+        shrunk = resizeTable(pTable, newSize);
+    }
+
+    if (!shrunk)
+    {
+        pTable -> shrinkLimit = (pTable -> numberOfElements) / (pTable -> growthFactor);
+    }
+}
+
+/**
+ * @brief Move the Elements of the chained Hash Table into a new Memory Pool, so the slabs of the
+ *        old Pool, which may be mostly free after mass removals, are released.
+ *        If run out of memory, the Table is left as it was.
+ * @param pTable A pointer to the Hash Table.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool repackElementPool(TableP pTable)
+{
+    assert(pTable != NULL && (pTable -> oldTable) == NULL);
+
+    size_t elementSize = sizeof(Element) + getInlineStorageSize(pTable -> inlineKeySize);
+    MemoryPoolP newPool = createMatchingMemoryPool(pTable -> elementPool);
+    BucketP newTable = (BucketP)calloc(pTable -> tableSize, sizeof(Bucket));
+    if (newPool == NULL || newTable == NULL)
+    {
+        freeMemoryPool(newPool);
+        free(newTable);
+        return false;
+    }
+
+    // The Elements are copied to the new Table, so the Table is untouched until all of them are.
+    for (size_t i = INITIAL_INDEX; i < (pTable -> tableSize); i++)
+    {
+        for (ElementP pElement = (pTable -> table)[i].head; pElement != NULL;
+             pElement = pElement -> next)
+        {
+            ElementP newElement = (ElementP)poolAllocate(newPool);
+            if (newElement == NULL)
+            {
+                freeMemoryPool(newPool);
+                free(newTable);
+                return false;
+            }
+
+            memcpy(newElement, pElement, elementSize);
+            if ((pElement -> key) == (KeyP)(pElement -> inlineKey))
+            {
+                newElement -> key = newElement -> inlineKey;
+            }
+            bucketAppendElement(&newTable[i], newElement);
+        }
+    }
+
+    freeMemoryPool(pTable -> elementPool);
+    pTable -> elementPool = newPool;
+    free(pTable -> table);
+    pTable -> table = newTable;
+    return true;
+}
+
+/**
+ * @brief Shrink the Hash Table to the smallest size which holds it's objects without passing
+ *        the max load factor, but not below it's original size. A SPAN_GROWTH Table shrinks
+ *        only as far as the Elements of each original cell fit.
+ * @param pTable A pointer to the Hash Table.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool compactCells(TableP pTable)
+{
+    assert(pTable != NULL && (pTable -> oldTable) == NULL);
+
+    size_t newSize = getReservedSize(pTable, pTable -> originalSize, pTable -> numberOfElements);
+    if (newSize == NO_ELEMENTS || newSize >= (pTable -> tableSize))
+    {
+        return true;
+    }
+
+    if ((pTable -> engine) == ROBIN_HOOD_ENGINE)
+    {
+        return robinHoodResize(pTable, newSize);
+    }
+    if ((pTable -> engine) == CUCKOO_ENGINE)
+    {
+        // A cuckoo Table which can not place all it's objects in a size tries the next one, but
+        // a size which could not be allocated fails the process.
+        bool outOfMemory = false;
+        while (newSize < (pTable -> tableSize) && !cuckooResize(pTable, newSize, &outOfMemory))
+        {
+            if (outOfMemory)
+            {
+                return false;
+            }
+            newSize *= pTable -> growthFactor;
+        }
+        return true;
+    }
+    if ((pTable -> growthMode) != SPAN_GROWTH)
+    {
+        return rebuildTable(pTable, newSize);
+    }
+
+    while ((pTable -> tableSize) > newSize)
+    {
+        size_t smallerSize = (pTable -> tableSize) / (pTable -> growthFactor);
+        if (!spanElementsFit(pTable, smallerSize / (pTable -> originalSize)))
+        {
+            break;
+        }
+        if (!rebuildTable(pTable, smallerSize))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Fill the given options with the defaults used by createTable.
+ * @param options A pointer to the options to fill.
+ */
+void setDefaultTableOptions(TableOptions *options)
+{
+    if (options == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return;
+    }
+
+    options -> engine = CHAINED_ENGINE;
+    options -> growthMode = SPAN_GROWTH;
+    options -> arenaAlloc = NULL;
+    options -> arenaFree = NULL;
+    options -> arena = NULL;
+    options -> inlineKeySize = NO_INLINE_KEY;
+    options -> keySize = NULL;
+    options -> bucketCapacity = MAX_ROW_ELEMENTS;
+    options -> maxLoadFactor = ENGINE_LOAD_FACTOR;
+    options -> growthFactor = RESIZE_FACTOR;
+    options -> minLoadFactor = NO_SHRINK;
+    options -> expectedElements = NO_ELEMENTS;
+    options -> hfun64 = NULL;
+    options -> seededHfun = NULL;
+    options -> floodChainLength = FLOOD_CHAIN_LENGTH;
+    options -> arenaKeys = false;
+    options -> internKeys = false;
+    options -> keyArena = NULL;
+    options -> resizeThreads = SERIAL_RESIZE;
+}
+
+/**
+ * @brief Checks whether the given options describe a Hash Table that can be created.
+ * @param options A pointer to the options to check.
+ * @return true if the options are valid, false otherwise.
+ */
+static bool validateTableOptions(const TableOptions *options)
+{
+    assert(options != NULL);
+
+    if ((options -> engine) != CHAINED_ENGINE && (options -> engine) != ROBIN_HOOD_ENGINE
+        && (options -> engine) != CUCKOO_ENGINE)
+    {
+        return false;
+    }
+
+    // A Robin Hood Table must always keep an empty slot, a cuckoo Table can not hold more than
+    // full Buckets, and a shrunk Table must not be loaded enough to grow right back.
+    double maxLoadFactor = getMaxLoadFactor(options);
+    if ((options -> bucketCapacity) < 1 || (options -> growthFactor) < MIN_RESIZE_FACTOR
+        || !(maxLoadFactor > 0) || !((options -> minLoadFactor) >= NO_SHRINK)
+        || ((options -> engine) == ROBIN_HOOD_ENGINE && maxLoadFactor >= FULL_LOAD)
+        || ((options -> engine) == CUCKOO_ENGINE && maxLoadFactor > CUCKOO_BUCKET_SLOTS)
+        || (options -> minLoadFactor) * (options -> growthFactor) >= maxLoadFactor)
+    {
+        return false;
+    }
+
+    // The keys are copied into a Key Arena by their size.
+    if (((options -> arenaKeys) || (options -> keyArena) != NULL) && (options -> keySize) == NULL)
+    {
+        return false;
+    }
+
+    // A cuckoo Table holds at most CUCKOO_MAX_SHARED_HASH keys of a single full Hash Code, which
+    // ordinary keys reach under an int Hash function, such as anagrams under strFcn.
+    if ((options -> engine) == CUCKOO_ENGINE && (options -> hfun64) == NULL
+        && (options -> seededHfun) == NULL)
+    {
+        return false;
+    }
+    return (options -> growthMode) == SPAN_GROWTH || (options -> growthMode) == REHASH_GROWTH
+           || (options -> growthMode) == INCREMENTAL_GROWTH;
+}
+
+/**
+ * @brief Allocate memory for a Hash Table with which uses the given functions.
+ *        If run out of memory, free all the memory that was already allocated by the function,
+ *        report error MEM_OUT to the standard error and return NULL.
+ * @param tableSize The number of cells in the hash table.
+ * @param cloneKey A pointer for the Key Cloning function.
+ * @param freeKey A pointer for the Free Key function.
+ * @param hfun A pointer for the Hash function.
+ * @param printKeyFun A pointer for the Print Key function.
+ * @param printDataFun A pointer for the Print Data function.
+ * @param fcomp A pointer for the Key Comparison function.
+ * @return A pointer for the new allocated Hash Table if allocation was successful,
+ *         otherwise return NULL.
+ */
+TableP createTable(size_t tableSize, CloneKeyFcn cloneKey, FreeKeyFcn freeKey, HashFcn hfun,
+                   PrintKeyFcn printKeyFun, PrintDataFcn printDataFun, ComparisonFcn fcomp)
+{
+    TableOptions options;
+    setDefaultTableOptions(&options);
+
+    return createTableWithOptions(tableSize, &options, cloneKey, freeKey, hfun, printKeyFun,
+                                  printDataFun, fcomp);
+}
+
+/**
+ * @brief Allocate memory for a Hash Table which uses the given functions and behaves as
+ *        described by the given options.
+ *        If run out of memory, free all the memory that was already allocated by the function,
+ *        report error MEM_OUT to the standard error and return NULL.
+ * @param tableSize The number of cells in the hash table.
+ * @param options A pointer for the options of the Hash Table.
+ * @param cloneKey A pointer for the Key Cloning function.
+ * @param freeKey A pointer for the Free Key function.
+ * @param hfun A pointer for the Hash function, may be NULL if the options hold a 64 bit one or
+ *        a seeded one which is used from the start.
+ * @param printKeyFun A pointer for the Print Key function.
+ * @param printDataFun A pointer for the Print Data function.
+ * @param fcomp A pointer for the Key Comparison function.
+ * @return A pointer for the new allocated Hash Table if allocation was successful,
+ *         otherwise return NULL.
+ */
+TableP createTableWithOptions(size_t tableSize, const TableOptions *options, CloneKeyFcn cloneKey,
+                              FreeKeyFcn freeKey, HashFcn hfun, PrintKeyFcn printKeyFun,
+                              PrintDataFcn printDataFun, ComparisonFcn fcomp)
+{
+    TableP pTable = NULL;
+
+    if (tableSize < MINIMAL_TABLE_SIZE || options == NULL || !validateTableOptions(options))
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    if (cloneKey == NULL || freeKey == NULL
+        || (hfun == NULL && (options -> hfun64) == NULL && !isSeededFromStart(options))
+        || printKeyFun == NULL || printDataFun == NULL || fcomp == NULL)
+    {
+        // If some function input is invalid, we can't continue our program.
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    pTable = initializeTable(tableSize, options, cloneKey, freeKey, hfun, printKeyFun,
+                             printDataFun, fcomp);
+    if (pTable == NULL)
+    {
+        // If some part of the memory allocation for the Hash Table was failed.
+        reportError(MEM_OUT);
+        return NULL;
+    }
+
+    if ((options -> expectedElements) > NO_ELEMENTS && !reserveTable(pTable, options -> expectedElements))
+    {
+        // The reserveTable function already reports of the error.
+        freeTable(pTable);
+        pTable = NULL;
+    }
+    return pTable;
+}
+
+/**
+ * @brief Grow the Hash Table at once to the size in which the given number of objects would be
+ *        inserted without any further resize.
+ *        If the Table is already large enough, no operation is performed.
+ *        If run out of memory, report MEM_OUT and leave the Table as it was.
+ * @param table A pointer for the Hash Table.
+ * @param expectedElements The number of objects the Table should hold.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int reserveTable(TableP table, size_t expectedElements)
+{
+    if (table == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return false;
+    }
+
+    size_t newSize = getReservedSize(table, table -> tableSize, expectedElements);
+    if (newSize == NO_ELEMENTS)
+    {
+        reportError(GENERAL_ERROR);
+        return false;
+    }
+
+    if (!reserveCells(table, newSize))
+    {
+        reportError(MEM_OUT);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Shrink the Hash Table to the smallest size which holds it's current objects, and move
+ *        the Elements of a chained Table into fresh memory, so the memory of the Table tracks
+ *        it's objects rather than it's peak.
+ *        An incremental resize in progress is completed first.
+ *        If run out of memory, report MEM_OUT and leave the Table valid.
+ * @param table A pointer for the Hash Table.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int compactTable(TableP table)
+{
+    if (table == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return false;
+    }
+
+    if ((table -> engine) == CHAINED_ENGINE)
+    {
+        migrateOldCells(table, table -> oldSize);
+    }
+
+    if (!compactCells(table)
+        || ((table -> engine) == CHAINED_ENGINE && !repackElementPool(table)))
+    {
+        reportError(MEM_OUT);
+        return false;
+    }
+    table -> shrinkLimit = NO_SHRINK_LIMIT;
+    return true;
+}
+
+/**
+ * @brief Search the chained Hash Table for the given key, and insert it with the given object
+ *        if it is not found. Each chain is walked once.
+ *        If all the cells appropriate for the new key are full, the Table is resized first,
+ *        unless they hold so many Elements that the Table switches to it's seeded Hash function.
+ * @param table A pointer for the Hash Table.
+ * @param key The key to search or insert.
+ * @param keyHash A pointer to the Hash Codes of the key.
+ * @param object The object to store by the key if it is inserted.
+ * @param found A pointer to update with whether the key was already in the Table.
+ * @return A pointer to the data of the key in it's Element, or NULL if an error occurred.
+ */
+static DataP *chainedLookupOrInsert(TableP table, const void *key, const KeyHash *keyHash,
+                                    DataP object, bool *found)
+{
+    assert(table != NULL && key != NULL && keyHash != NULL && object != NULL && found != NULL);
+
+    HashCode fullHashCode = keyHash -> fullHashCode;
+    size_t hashCode = getKeyCell(table, keyHash);
+    assert(hashCode < (table -> tableSize));
+
+    // If the given key is already exists in the Hash Table, we return it's data.
+    BucketP currentBucket = NULL;
+    size_t arrCell = NO_POSITION;
+    size_t listNode = NO_POSITION;
+    ElementP *link = chainedFindLink(table, key, hashCode, fullHashCode, &currentBucket,
+                                     &arrCell, &listNode);
+    if (link != NULL)
+    {
+        *found = true;
+        return &((*link) -> data);
+    }
+    *found = false;
+
+    // A rehashed Table grows once the new Element would pass it's max load factor, unless
+    // the previous incremental resize was not completed yet.
+    bool overloaded = (table -> growthMode) != SPAN_GROWTH && (table -> oldTable) == NULL
+                      && (table -> numberOfElements) + 1 > (table -> maxLoadFactor) * (table -> tableSize);
+
+    ElementP newElement = NULL;
+    // Iterate through the possible Buckets to insert.
+    for (size_t i = INITIAL_INDEX; i < getProbeSpan(table); i++)
+    {
+        currentBucket = &((table -> table)[hashCode + i]);
+        if (!overloaded && (currentBucket -> numberOfElements) < (table -> bucketCapacity))
+        {
+            // If we enter this Scope, the current Bucket has place to store the new Element.
+            newElement = tableInsertElement(table, currentBucket, key, fullHashCode, object);
+            return (newElement != NULL) ? &(newElement -> data) : NULL;
+        }
+    }
+
+    // An insert which searched an abnormally long chain, or a full span, switches the Table to
+    // it's seeded Hash function, so crafted keys do not keep colliding or growing the Table.
+    size_t searchedElements = ((table -> growthMode) == SPAN_GROWTH)
+                              ? getProbeSpan(table) * (table -> bucketCapacity)
+                              : currentBucket -> numberOfElements;
+    if (!overloaded && (table -> seededHfun) != NULL && !(table -> hashSeeded)
+        && searchedElements >= (table -> floodChainLength) && seedTableHash(table))
+    {
+        KeyHash seededKeyHash;
+        generateKeyHash(table, key, &seededKeyHash);
+        return chainedLookupOrInsert(table, key, &seededKeyHash, object, found);
+    }
+
+    if ((table -> growthMode) != SPAN_GROWTH && !overloaded)
+    {
+        // The Table is still sparse, so a resize will not help these colliding keys, or
+        // the previous incremental resize was not completed yet.
+        newElement = tableInsertElement(table, currentBucket, key, fullHashCode, object);
+        return (newElement != NULL) ? &(newElement -> data) : NULL;
+    }
+
+    // If all the associated Buckets are not available, we have to resize the Hash Table.
+    if (!resizeTable(table, (table -> tableSize) * (table -> growthFactor)))
+    {
+        // If 'resizeTable' return false, it means that there
+        // wasn't enough memory to allocate the new Table.
+        reportError(MEM_OUT);
+        return NULL;
+    }
+    // Attempt to try again inserting the new key.
+    return chainedLookupOrInsert(table, key, keyHash, object, found);
+}
+
+/**
+ * @brief Search the Hash Table for the given key, and insert it with the given object if it is
+ *        not found.
+ * @param table A pointer for the Hash Table.
+ * @param key The key to search or insert.
+ * @param keyHash A pointer to the Hash Codes of the key.
+ * @param object The object to store by the key if it is inserted.
+ * @param found A pointer to update with whether the key was already in the Table.
+ * @return A pointer to the data of the key, or NULL if an error occurred.
+ */
+static DataP *tableLookupOrInsert(TableP table, const void *key, const KeyHash *keyHash,
+                                  DataP object, bool *found)
+{
+    assert(table != NULL && key != NULL && keyHash != NULL && object != NULL && found != NULL);
+
+    if ((table -> engine) == ROBIN_HOOD_ENGINE)
+    {
+        return robinHoodLookupOrInsert(table, key, keyHash -> fullHashCode, object, found);
+    }
+    if ((table -> engine) == CUCKOO_ENGINE)
+    {
+        return cuckooLookupOrInsert(table, key, keyHash -> fullHashCode, object, found);
+    }
+    return chainedLookupOrInsert(table, key, keyHash, object, found);
+}
+
+/**
+ * @brief Insert an object to the Hash Table with the key of the given Hash Codes, or replace the
+ *        object of the key if it is already in the Table.
+ * @param table A pointer for the Hash Table to insert to.
+ * @param key The key to insert.
+ * @param keyHash A pointer to the Hash Codes of the key.
+ * @param object The object that is stored by the given key.
+ * @param previous A pointer to update with the replaced object, or NULL.
+ * @return true if the process succeed, false otherwise.
+ */
+static bool tableUpsert(TableP table, const void *key, const KeyHash *keyHash, DataP object,
+                        DataP *previous)
+{
+    assert(table != NULL && key != NULL && keyHash != NULL && object != NULL);
+
+    bool found = false;
+    DataP *data = tableLookupOrInsert(table, key, keyHash, object, &found);
+    if (data == NULL)
+    {
+        return false;
+    }
+
+    DataP previousData = NULL;
+    if (found)
+    {
+        // If the given key is already exists in the Hash Table, we replace it's data with the new data.
+        previousData = *data;
+        *data = object;
+    }
+    if (previous != NULL)
+    {
+        *previous = previousData;
+    }
+    return true;
+}
+
+/**
+ * @brief Insert an object to the Hash Table with key.
+ *        If all the cells appropriate for this object are full, duplicate the table.
+ *        If run out of memory, report MEM_OUT and do nothing (the table should stay at
+ *        the same situation as it was before the duplication).
+ *        If everything is OK, return true, otherwise (an error occurred) return false.
+ * @param table A pointer for the Hash Table to insert to.
+ * @param key The key to insert.
+ * @param object The object that is stored by the given key.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int insert(TableP table, const void *key, DataP object)
+{
+    return upsert(table, key, object, NULL);
+}
+
+/**
+ * @brief Insert an object to the Hash Table with key, or replace the object of the key if it
+ *        is already in the Table. The key is hashed once, and each chain is walked once.
+ *        If previous is not NULL, it is updated with the replaced object, or NULL if the key
+ *        was inserted.
+ * @param table A pointer for the Hash Table to insert to.
+ * @param key The key to insert.
+ * @param object The object that is stored by the given key.
+ * @param previous A pointer to update with the replaced object, or NULL.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int upsert(TableP table, const void *key, DataP object, DataP *previous)
+{
+    KeyHash keyHash;
+    if (table == NULL || key == NULL || object == NULL || !generateKeyHash(table, key, &keyHash))
+    {
+        reportError(GENERAL_ERROR);
+        return false;
+    }
+
+    return tableUpsert(table, key, &keyHash, object, previous);
+}
+
+/**
+ * @brief Return a pointer to the data of the given key in the Hash Table. If the key is not in
+ *        the Table, it is inserted with the given default data first.
+ *        The pointer may be used to update the data in place, until the next insert or remove.
+ * @param table A pointer for the Hash Table.
+ * @param key The key to search or insert.
+ * @param defaultData The data to insert with the key if it is not in the Table.
+ * @return A pointer to the data of the key, or NULL if an error occurred.
+ */
+DataP *getOrInsert(TableP table, const void *key, DataP defaultData)
+{
+    KeyHash keyHash;
+    if (table == NULL || key == NULL || defaultData == NULL
+        || !generateKeyHash(table, key, &keyHash))
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    bool found = false;
+    return tableLookupOrInsert(table, key, &keyHash, defaultData, &found);
+}
+
+/**
+ * @brief Remove a data from the chained Hash Table. The chain of the key is walked once.
+ * @param table A pointer for the Hash Table to remove from.
+ * @param key The key to remove.
+ * @param keyHash A pointer to the Hash Codes of the key.
+ * @return pointer to the ejected data if the remove process succeed, otherwise return NULL.
+ */
+static DataP chainedRemove(TableP table, const void *key, const KeyHash *keyHash)
+{
+    assert(table != NULL && key != NULL && keyHash != NULL);
+
+    HashCode fullHashCode = keyHash -> fullHashCode;
+    size_t hashCode = getKeyCell(table, keyHash);
+
+    // Track the desired Element to remove, and unlink it with the link that points to it.
+    BucketP currentBucket = NULL;
+    size_t arrCell = NO_POSITION;
+    size_t listNode = NO_POSITION;
+    ElementP *link = chainedFindLink(table, key, hashCode, fullHashCode, &currentBucket,
+                                     &arrCell, &listNode);
+    if (link == NULL)
+    {
+        return NULL;
+    }
+
+    DataP removedData = bucketUnlinkElement(currentBucket, link, listNode, table -> freeKey,
+                                            table -> elementPool);
+    (table -> numberOfElements)--;
+    return removedData;
+}
+
+/**
+ * @brief Remove a data from the Hash Table by the key of the given Hash Codes, and shrink the
+ *        Table if it is left underloaded.
+ * @param table A pointer for the Hash Table to remove from.
+ * @param key The key to remove.
+ * @param keyHash A pointer to the Hash Codes of the key.
+ * @return pointer to the ejected data if the remove process succeed, otherwise return NULL.
+ */
+static DataP tableRemove(TableP table, const void *key, const KeyHash *keyHash)
+{
+    assert(table != NULL && key != NULL && keyHash != NULL);
+
+    DataP removedData = NULL;
+    if ((table -> engine) == ROBIN_HOOD_ENGINE)
+    {
+        removedData = robinHoodRemove(table, key, keyHash -> fullHashCode);
+    }
+    else if ((table -> engine) == CUCKOO_ENGINE)
+    {
+        removedData = cuckooRemove(table, key, keyHash -> fullHashCode);
+    }
+    else
+    {
+        removedData = chainedRemove(table, key, keyHash);
+    }
+
+    if (removedData != NULL && isUnderloaded(table))
+    {
+        shrinkTable(table);
+    }
+    return removedData;
+}
+
+/**
+ * @brief Remove a data from the Hash Table.
+ *        If everything is OK, return the pointer to the ejected data, otherwise return NULL.
+ * @param table A pointer for the Hash Table to remove from.
+ * @param key The key to remove.
+ * @return pointer to the ejected data if the remove process succeed, otherwise return NULL.
+ */
+DataP removeData(TableP table, const void *key)
+{
+    KeyHash keyHash;
+    if (table == NULL || key == NULL || !generateKeyHash(table, key, &keyHash))
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    return tableRemove(table, key, &keyHash);
+}
+
+
+/**
+ * @brief Search the Hash Table for the key of the given Hash Codes.
+ * @param table A pointer for the Hash Table to search in.
+ * @param key The key to search.
+ * @param keyHash A pointer to the Hash Codes of the key.
+ * @param arrCell A pointer to update with the proper cell number.
+ * @param listNode A pointer to update with the proper Node placement.
+ * @return A pointer to the data if found, otherwise return NULL.
+ */
+static DataP tableFindData(const TableP table, const void *key, const KeyHash *keyHash,
+                           size_t *arrCell, size_t *listNode)
+{
+    assert(table != NULL && key != NULL && keyHash != NULL);
+    assert(arrCell != NULL && listNode != NULL);
+
+    if ((table -> engine) == ROBIN_HOOD_ENGINE)
+    {
+        return robinHoodFindData(table, key, keyHash -> fullHashCode, arrCell, listNode);
+    }
+    if ((table -> engine) == CUCKOO_ENGINE)
+    {
+        return cuckooFindData(table, key, keyHash -> fullHashCode, arrCell, listNode);
+    }
+
+    BucketP currentBucket = NULL;
+    ElementP *link = chainedFindLink(table, key, getKeyCell(table, keyHash),
+                                     keyHash -> fullHashCode, &currentBucket, arrCell, listNode);
+    return (link != NULL) ? (*link) -> data : NULL;
+}
+
+/**
+ * @brief Search the table and look for an object with the given key.
+ *        If such object is found fill its cell number into arrCell (where 0 is the first cell),
+ *        and its placement in the list into listNode (when 0 is the first node in the list,
+ *        i.e. the node that is pointed from the table itself).
+ *        If the key was not found, fill both pointers with NO_POSITION.
+ * @param table A pointer for the Hash Table to search in.
+ * @param key The key to search.
+ * @param arrCell A pointer to update with the proper cell number.
+ * @param listNode A pointer to update with the proper Node placement.
+ * @return A pointer to the data if found, otherwise return NULL.
+ */
+DataP findData64(const TableP table, const void *key, size_t *arrCell, size_t *listNode)
+{
+    if (table == NULL || key == NULL || arrCell == NULL || listNode == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    *arrCell = NO_POSITION;
+    *listNode = NO_POSITION;
+
+    // Generate the Hash Codes for the given key.
+    KeyHash keyHash;
+    if (!generateKeyHash(table, key, &keyHash))
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+    return tableFindData(table, key, &keyHash, arrCell, listNode);
+}
+
+/**
+ * @brief Returns the given position as an int position.
+ * @param position The position of a cell or a node.
+ * @return The position, or -1 if it does not exist or does not fit in an int.
+ */
+static inline int getIntPosition(size_t position)
+{
+    return (position <= (size_t)INT_MAX) ? (int)position : INVALID_INDEX;
+}
+
+/**
+ * @brief Search the table and look for an object with the given key.
+ *        If such object is found fill its cell number into arrCell (where 0 is the first cell),
+ *        and its placement in the list into listNode (when 0 is the first node in the list,
+ *        i.e. the node that is pointed from the table itself).
+ *        If the key was not found, or it's position does not fit in an int, fill both pointers
+ *        with value of -1.
+ * @param table A pointer for the Hash Table to search in.
+ * @param key The key to search.
+ * @param arrCell A pointer to update with the proper cell number.
+ * @param listNode A pointer to update with the proper Node placement.
+ * @return A pointer to the data if found, otherwise return NULL.
+ */
+DataP findData(const TableP table, const void *key, int *arrCell, int *listNode)
+{
+    if (table == NULL || key == NULL || arrCell == NULL || listNode == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    *arrCell = INVALID_INDEX;
+    *listNode = INVALID_INDEX;
+
+    // The key is searched here and not through findData64, so a lookup makes no extra call.
+    KeyHash keyHash;
+    if (!generateKeyHash(table, key, &keyHash))
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    size_t cell = NO_POSITION;
+    size_t node = NO_POSITION;
+    DataP foundData = tableFindData(table, key, &keyHash, &cell, &node);
+    *arrCell = getIntPosition(cell);
+    *listNode = getIntPosition(node);
+    if (*arrCell == INVALID_INDEX || *listNode == INVALID_INDEX)
+    {
+        *arrCell = INVALID_INDEX;
+        *listNode = INVALID_INDEX;
+    }
+    return foundData;
+}
+
+/**
+ * @brief Returns the number of keys in the group of a batch which starts at the given key.
+ * @param first The index of the first key of the group.
+ * @param numberOfKeys The number of keys in the batch.
+ * @return The number of keys in the group.
+ */
+static inline size_t getBatchGroupSize(size_t first, size_t numberOfKeys)
+{
+    assert(first < numberOfKeys);
+
+    size_t remainingKeys = numberOfKeys - first;
+    return (remainingKeys < BATCH_GROUP_SIZE) ? remainingKeys : BATCH_GROUP_SIZE;
+}
+
+/**
+ * @brief Search the Hash Table for each of the given keys, and fill it's data, or NULL if it is
+ *        not found, into the same place in results.
+ *        The keys are handled in groups, the Hash Codes of a whole group are generated and it's
+ *        cells are prefetched before any of it's keys is searched.
+ *        A NULL key reports GENERAL_ERROR, and it's result is NULL.
+ * @param table A pointer for the Hash Table to search in.
+ * @param keys The keys to search.
+ * @param numberOfKeys The number of keys.
+ * @param results The array to update with the data of each key.
+ * @return The number of keys that were found.
+ */
+size_t findDataBatch(const TableP table, const void *const *keys, size_t numberOfKeys,
+                     DataP *results)
+{
+    if (table == NULL || (numberOfKeys > NO_ELEMENTS && (keys == NULL || results == NULL)))
+    {
+        reportError(GENERAL_ERROR);
+        return NO_ELEMENTS;
+    }
+
+    KeyHash keyHashes[BATCH_GROUP_SIZE];
+    bool hashed[BATCH_GROUP_SIZE];
+    size_t numberFound = NO_ELEMENTS;
+    for (size_t first = INITIAL_INDEX; first < numberOfKeys; first += BATCH_GROUP_SIZE)
+    {
+        size_t groupSize = getBatchGroupSize(first, numberOfKeys);
+        prepareKeyGroup(table, &keys[first], groupSize, keyHashes, hashed);
+        for (size_t i = INITIAL_INDEX; i < groupSize; i++)
+        {
+            size_t arrCell = NO_POSITION;
+            size_t listNode = NO_POSITION;
+            results[first + i] = NULL;
+            if (!hashed[i])
+            {
+                reportError(GENERAL_ERROR);
+            }
+            else
+            {
+                results[first + i] = tableFindData(table, keys[first + i], &keyHashes[i],
+                                                   &arrCell, &listNode);
+                numberFound += (results[first + i] != NULL);
+            }
+        }
+    }
+    return numberFound;
+}
+
+/**
+ * @brief Insert each of the given keys to the Hash Table with the object in the same place in
+ *        objects, or replace the object of a key which is already in the Table.
+ *        The keys are handled in groups, as in findDataBatch.
+ *        The process stops at the first key which could not be inserted, the keys before it stay
+ *        in the Table.
+ * @param table A pointer for the Hash Table to insert to.
+ * @param keys The keys to insert.
+ * @param objects The objects that are stored by the given keys.
+ * @param numberOfKeys The number of keys.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int insertBatch(TableP table, const void *const *keys, const DataP *objects, size_t numberOfKeys)
+{
+    if (table == NULL || (numberOfKeys > NO_ELEMENTS && (keys == NULL || objects == NULL)))
+    {
+        reportError(GENERAL_ERROR);
+        return false;
+    }
+
+    KeyHash keyHashes[BATCH_GROUP_SIZE];
+    bool hashed[BATCH_GROUP_SIZE];
+    for (size_t first = INITIAL_INDEX; first < numberOfKeys; first += BATCH_GROUP_SIZE)
+    {
+        size_t groupSize = getBatchGroupSize(first, numberOfKeys);
+        prepareKeyGroup(table, &keys[first], groupSize, keyHashes, hashed);
+        for (size_t i = INITIAL_INDEX; i < groupSize; i++)
+        {
+            if (!hashed[i] || objects[first + i] == NULL)
+            {
+                reportError(GENERAL_ERROR);
+                return false;
+            }
+            bool seeded = table -> hashSeeded;
+            if (!tableUpsert(table, keys[first + i], &keyHashes[i], objects[first + i], NULL))
+            {
+                return false;
+            }
+            if ((table -> hashSeeded) != seeded)
+            {
+                // The Table was just seeded, so the rest of the group is hashed again.
+                prepareKeyGroup(table, &keys[first + i + 1], groupSize - i - 1,
+                                &keyHashes[i + 1], &hashed[i + 1]);
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Remove each of the given keys from the Hash Table, and fill it's ejected data, or NULL
+ *        if it is not found, into the same place in removed, if removed is not NULL.
+ *        The keys are handled in groups, as in findDataBatch.
+ *        A NULL key reports GENERAL_ERROR, and it's result is NULL.
+ * @param table A pointer for the Hash Table to remove from.
+ * @param keys The keys to remove.
+ * @param numberOfKeys The number of keys.
+ * @param removed The array to update with the ejected data of each key, or NULL.
+ * @return The number of keys that were removed.
+ */
+size_t removeDataBatch(TableP table, const void *const *keys, size_t numberOfKeys, DataP *removed)
+{
+    if (table == NULL || (numberOfKeys > NO_ELEMENTS && keys == NULL))
+    {
+        reportError(GENERAL_ERROR);
+        return NO_ELEMENTS;
+    }
+
+    KeyHash keyHashes[BATCH_GROUP_SIZE];
+    bool hashed[BATCH_GROUP_SIZE];
+    size_t numberRemoved = NO_ELEMENTS;
+    for (size_t first = INITIAL_INDEX; first < numberOfKeys; first += BATCH_GROUP_SIZE)
+    {
+        size_t groupSize = getBatchGroupSize(first, numberOfKeys);
+        prepareKeyGroup(table, &keys[first], groupSize, keyHashes, hashed);
+        for (size_t i = INITIAL_INDEX; i < groupSize; i++)
+        {
+            DataP removedData = NULL;
+            if (!hashed[i])
+            {
+                reportError(GENERAL_ERROR);
+            }
+            else
+            {
+                removedData = tableRemove(table, keys[first + i], &keyHashes[i]);
+                numberRemoved += (removedData != NULL);
+            }
+            if (removed != NULL)
+            {
+                removed[first + i] = removedData;
+            }
+        }
+    }
+    return numberRemoved;
+}
+
+/**
+ * @brief Returns the partition of a parallel build which holds the given cell, so each
+ *        partition is a range of cells of about the same size.
+ * @param cell The cell.
+ * @param tableSize The size of the Table.
+ * @param numberOfTasks The number of partitions.
+ * @return The partition of the cell.
+ */
+static inline size_t getBuildPartition(size_t cell, size_t tableSize, size_t numberOfTasks)
+{
+    return (size_t)(((uint64_t)cell * numberOfTasks) / tableSize);
+}
+
+/**
+ * @brief The start routine of the first phase of a parallel build. Hashes each key of the slice
+ *        of the task into it's preallocated Element, and counts the keys of each partition.
+ *        A NULL key or object, or an invalid Hash Code, fails the task.
+ * @param task A pointer to the task.
+ * @return NULL.
+ */
+static void *hashBuildSliceThread(void *task)
+{
+    BuildTask *pTask = (BuildTask *)task;
+    TableP pTable = pTask -> pTable;
+    for (size_t i = pTask -> firstKey; i < (pTask -> endKey); i++)
+    {
+        KeyHash keyHash;
+        if ((pTask -> keys)[i] == NULL || (pTask -> objects)[i] == NULL
+            || !generateKeyHash(pTable, (pTask -> keys)[i], &keyHash))
+        {
+            pTask -> failed = true;
+            return NULL;
+        }
+        (pTask -> elements)[i] -> hashCode = keyHash.fullHashCode;
+        size_t cell = getKeyCell(pTable, &keyHash);
+        (pTask -> partitionCounts)[getBuildPartition(cell, pTable -> tableSize,
+                                                     pTask -> numberOfTasks)]++;
+    }
+    return NULL;
+}
+
+/**
+ * @brief The start routine of the second phase of a parallel build. Writes the index of each key
+ *        of the slice of the task to the order array, at the next offset of the task in the
+ *        partition of the key, so the keys of each partition keep their order.
+ * @param task A pointer to the task, whose partition counts hold it's offsets.
+ * @return NULL.
+ */
+static void *scatterBuildSliceThread(void *task)
+{
+    BuildTask *pTask = (BuildTask *)task;
+    TableP pTable = pTask -> pTable;
+    for (size_t i = pTask -> firstKey; i < (pTask -> endKey); i++)
+    {
+        size_t cell = reduceHashCode((pTask -> elements)[i] -> hashCode, pTable -> tableSize);
+        size_t partition = getBuildPartition(cell, pTable -> tableSize, pTask -> numberOfTasks);
+        (pTask -> order)[((pTask -> partitionCounts)[partition])++] = i;
+    }
+    return NULL;
+}
+
+/**
+ * @brief The start routine of the last phase of a parallel build. Inserts the keys of the
+ *        partition of the task into their Buckets, which no other task writes, as insert does.
+ *        A key which is already in the Table gets the later object, and it's Element is left
+ *        unused with a NULL key. If a key could not be stored, the task fails.
+ * @param task A pointer to the task.
+ * @return NULL.
+ */
+static void *fillBuildPartitionThread(void *task)
+{
+    BuildTask *pTask = (BuildTask *)task;
+    TableP pTable = pTask -> pTable;
+    for (size_t j = pTask -> firstOrder; j < (pTask -> endOrder); j++)
+    {
+        size_t i = (pTask -> order)[j];
+        ElementP pElement = (pTask -> elements)[i];
+        BucketP pBucket = &((pTable -> table)[reduceHashCode(pElement -> hashCode,
+                                                             pTable -> tableSize)]);
+        size_t listNode = NO_POSITION;
+        ElementP *link = bucketFindLink(pBucket, (pTask -> keys)[i], pElement -> hashCode,
+                                        &listNode, pTable -> fcomp);
+        if (link != NULL)
+        {
+            (*link) -> data = (pTask -> objects)[i];
+            pElement -> key = NULL;
+            continue;
+        }
+
+        pElement -> key = storeKey(pTable, (pTask -> keys)[i], pElement -> inlineKey);
+        if ((pElement -> key) == NULL)
+        {
+            // The cloneKey function already reports of MEM_OUT.
+            pTask -> failed = true;
+            return NULL;
+        }
+        pElement -> data = (pTask -> objects)[i];
+        bucketAppendElement(pBucket, pElement);
+        (pTask -> insertedElements)++;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Returns the number of threads which build the given Hash Table from the given number
+ *        of keys. Only a rehashed chained Table, whose keys are each in a single cell, is built
+ *        in parallel, and only if it's keys are not copied into a Key Arena, which is written by
+ *        a single thread, and it does not switch to it's seeded Hash function on the way.
+ * @param pTable A pointer to the Hash Table.
+ * @param numberOfKeys The number of keys.
+ * @param numberOfThreads The max number of threads.
+ * @return The number of threads, at least 1.
+ */
+static size_t getBuildThreads(const TableP pTable, size_t numberOfKeys, size_t numberOfThreads)
+{
+    assert(pTable != NULL);
+
+    if ((pTable -> engine) != CHAINED_ENGINE || (pTable -> growthMode) == SPAN_GROWTH
+        || (pTable -> keyArena) != NULL
+        || ((pTable -> seededHfun) != NULL && !(pTable -> hashSeeded)))
+    {
+        return SERIAL_RESIZE;
+    }
+
+    size_t buildThreads = numberOfKeys / MIN_KEYS_PER_BUILD_THREAD;
+    if (buildThreads > numberOfThreads)
+    {
+        buildThreads = numberOfThreads;
+    }
+    return (buildThreads > SERIAL_RESIZE) ? buildThreads : SERIAL_RESIZE;
+}
+
+/**
+ * @brief Insert the given keys to the given empty Hash Table, which is already large enough for
+ *        them, on the given number of threads. Each thread hashes a slice of the keys, then the
+ *        keys are ordered by partitions of cells, and each thread inserts the keys of one
+ *        partition with no lock, as no other thread writes it's Buckets.
+ *        The Elements are allocated up front by the calling thread, as the Memory Pool is not
+ *        shared by threads, and the unused ones are returned to it at the end.
+ * @param pTable A pointer to the Hash Table.
+ * @param keys The keys to insert.
+ * @param objects The objects of the keys.
+ * @param numberOfKeys The number of keys.
+ * @param numberOfTasks The number of threads, more than 1.
+ * @return true if the process succeed, false otherwise, after reporting the error.
+ */
+static bool buildElementsParallel(TableP pTable, const void *const *keys, const DataP *objects,
+                                  size_t numberOfKeys, size_t numberOfTasks)
+{
+    assert(pTable != NULL && keys != NULL && objects != NULL && numberOfTasks > SERIAL_RESIZE);
+
+    BuildTask *tasks = (BuildTask *)calloc(numberOfTasks, sizeof(BuildTask));
+    size_t *partitionCounts = (size_t *)calloc(numberOfTasks * numberOfTasks, sizeof(size_t));
+    ElementP *elements = (ElementP *)malloc(numberOfKeys * sizeof(ElementP));
+    size_t *order = (size_t *)malloc(numberOfKeys * sizeof(size_t));
+    bool succeed = tasks != NULL && partitionCounts != NULL && elements != NULL && order != NULL;
+    size_t allocatedElements = NO_ELEMENTS;
+    while (succeed && allocatedElements < numberOfKeys)
+    {
+        elements[allocatedElements] = (ElementP)poolAllocate(pTable -> elementPool);
+        succeed = elements[allocatedElements] != NULL;
+        allocatedElements += succeed;
+    }
+    if (!succeed)
+    {
+        reportError(MEM_OUT);
+    }
+
+    for (size_t t = INITIAL_INDEX; succeed && t < numberOfTasks; t++)
+    {
+        tasks[t].pTable = pTable;
+        tasks[t].keys = keys;
+        tasks[t].objects = objects;
+        tasks[t].elements = elements;
+        tasks[t].order = order;
+        tasks[t].numberOfTasks = numberOfTasks;
+        tasks[t].partitionCounts = &partitionCounts[t * numberOfTasks];
+        tasks[t].firstKey = numberOfKeys / numberOfTasks * t;
+        tasks[t].endKey = (t + 1 == numberOfTasks) ? numberOfKeys : numberOfKeys / numberOfTasks * (t + 1);
+    }
+
+    if (succeed)
+    {
+        runThreadTasks(tasks, sizeof(BuildTask), numberOfTasks, hashBuildSliceThread);
+        for (size_t t = INITIAL_INDEX; t < numberOfTasks; t++)
+        {
+            succeed = succeed && !(tasks[t].failed);
+        }
+        if (!succeed)
+        {
+            reportError(GENERAL_ERROR);
+        }
+    }
+
+    if (succeed)
+    {
+        // The counts of each task become it's offsets in each partition, partition by partition.
+        size_t offset = INITIAL_INDEX;
+        for (size_t partition = INITIAL_INDEX; partition < numberOfTasks; partition++)
+        {
+            tasks[partition].firstOrder = offset;
+            for (size_t t = INITIAL_INDEX; t < numberOfTasks; t++)
+            {
+                size_t count = (tasks[t].partitionCounts)[partition];
+                (tasks[t].partitionCounts)[partition] = offset;
+                offset += count;
+            }
+            tasks[partition].endOrder = offset;
+        }
+        runThreadTasks(tasks, sizeof(BuildTask), numberOfTasks, scatterBuildSliceThread);
+        runThreadTasks(tasks, sizeof(BuildTask), numberOfTasks, fillBuildPartitionThread);
+        for (size_t t = INITIAL_INDEX; t < numberOfTasks; t++)
+        {
+            succeed = succeed && !(tasks[t].failed);
+            pTable -> numberOfElements += tasks[t].insertedElements;
+        }
+    }
+
+    // Every Element is either linked to a Bucket or returned to the Pool.
+    for (size_t i = INITIAL_INDEX; succeed && i < numberOfKeys; i++)
+    {
+        if ((elements[i] -> key) == NULL)
+        {
+            poolRelease(pTable -> elementPool, elements[i]);
+        }
+    }
+    free(tasks);
+    free(partitionCounts);
+    free(elements);
+    free(order);
+    return succeed;
+}
+
+/**
+ * @brief Create a Hash Table as createTableWithOptions does, sized once for numberOfKeys
+ *        objects, and insert each of the keys with the object in the same place in objects,
+ *        as insertBatch does, using up to numberOfThreads threads.
+ *        A chained REHASH_GROWTH or INCREMENTAL_GROWTH Table without a Key Arena, whose seeded
+ *        Hash function is used from the start if it has one, is built in parallel, and any
+ *        other Table with insertBatch. The keys and objects are only read during the build,
+ *        and cloneKey, keySize and the Hash and Comparison functions must be safe to call from
+ *        several threads at once.
+ *        If an error occurred, free all the memory of the Table, report it and return NULL.
+ * @param keys The keys to insert.
+ * @param objects The objects of the keys.
+ * @param numberOfKeys The number of keys.
+ * @param numberOfThreads The max number of threads.
+ * @param tableSize The number of cells in the hash table before it is sized.
+ * @param options A pointer for the options of the Hash Table.
+ * @param cloneKey A pointer for the Key Cloning function.
+ * @param freeKey A pointer for the Free Key function.
+ * @param hfun A pointer for the Hash function, may be NULL as in createTableWithOptions.
+ * @param printKeyFun A pointer for the Print Key function.
+ * @param printDataFun A pointer for the Print Data function.
+ * @param fcomp A pointer for the Key Comparison function.
+ * @return A pointer for the new Hash Table, or NULL if the process failed.
+ */
+TableP buildTableParallel(const void *const *keys, const DataP *objects, size_t numberOfKeys,
+                          size_t numberOfThreads, size_t tableSize, const TableOptions *options,
+                          CloneKeyFcn cloneKey, FreeKeyFcn freeKey, HashFcn hfun,
+                          PrintKeyFcn printKeyFun, PrintDataFcn printDataFun, ComparisonFcn fcomp)
+{
+    if (options == NULL || (numberOfKeys > NO_ELEMENTS && (keys == NULL || objects == NULL)))
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    TableOptions buildOptions = *options;
+    if ((buildOptions.expectedElements) < numberOfKeys)
+    {
+        buildOptions.expectedElements = numberOfKeys;
+    }
+    // The creation of the Table already reports of it's errors.
+    TableP pTable = createTableWithOptions(tableSize, &buildOptions, cloneKey, freeKey, hfun,
+                                           printKeyFun, printDataFun, fcomp);
+    if (pTable == NULL)
+    {
+        return NULL;
+    }
+
+    size_t buildThreads = getBuildThreads(pTable, numberOfKeys, numberOfThreads);
+    bool built = (buildThreads > SERIAL_RESIZE) ?
+                 buildElementsParallel(pTable, keys, objects, numberOfKeys, buildThreads) :
+                 insertBatch(pTable, keys, objects, numberOfKeys);
+    if (!built)
+    {
+        freeTable(pTable);
+        return NULL;
+    }
+    return pTable;
+}
+
+/**
+ * @brief Return the Slot of the Robin Hood or cuckoo Hash Table in the given place, if it holds
+ *        an object.
+ * @param table A pointer to the Table.
+ * @param arrCell The cell number in the Hash Table.
+ * @param listNode The placement in the specific cell number.
+ * @return A pointer to the Slot in the desired place, if it's empty or not exist return NULL.
+ */
+static SlotP reachSlot(const TableP table, size_t arrCell, size_t listNode)
+{
+    assert(table != NULL && (table -> engine) != CHAINED_ENGINE);
+
+    if ((table -> engine) == CUCKOO_ENGINE)
+    {
+        return cuckooReachSlot(table, arrCell, listNode);
+    }
+    return robinHoodReachSlot(table, arrCell, listNode);
+}
+
+/**
+ * @brief Return a pointer to the data that exist in the table in cell number arrCell
+ *        (where 0 is the first cell), and placement at listNode in the list
+ *        (when 0 is the first node in the list, i.e. the node that is pointed from the
+ *        table itself). If such data not exist return NULL
+ * @param table A pointer to the Table to search.
+ * @param arrCell The cell number in the Hash Table.
+ * @param listNode The placement of the Element in the specific cell number.
+ * @return A pointer to the data in the desired place, if such data not exist return NULL.
+ */
+DataP getDataAt64(const TableP table, size_t arrCell, size_t listNode)
+{
+    if (table == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    // If the given cell is out of bounds, there is no need to search.
+    if (arrCell >= getNumberOfCells(table))
+    {
+        return NULL;
+    }
+
+    DataP foundData = NULL;
+    if ((table -> engine) != CHAINED_ENGINE)
+    {
+        SlotP pSlot = reachSlot(table, arrCell, listNode);
+        if (pSlot != NULL)
+        {
+            foundData = pSlot -> data;
+        }
+        return foundData;
+    }
+
+    ElementP pElement = NULL;
+    pElement = reachElement(table, arrCell, listNode);
+    if (pElement != NULL)
+    {
+        foundData = pElement -> data;
+    }
+    return foundData;
+}
+
+/**
+ * @brief Return a pointer to the data that exist in the table in cell number arrCell
+ *        (where 0 is the first cell), and placement at listNode in the list
+ *        (when 0 is the first node in the list, i.e. the node that is pointed from the
+ *        table itself). If such data not exist return NULL
+ * @param table A pointer to the Table to search.
+ * @param arrCell The cell number in the Hash Table.
+ * @param listNode The placement of the Element in the specific cell number.
+ * @return A pointer to the data in the desired place, if such data not exist return NULL.
  */
-static bool resizeTable(TableP pTable)
+DataP getDataAt(const TableP table, int arrCell, int listNode)
 {
-    assert(pTable != NULL);
-
-    size_t currentSize = (pTable -> tableSize);
-    size_t newSize = currentSize * RESIZE_FACTOR;
-
-    BucketP *newTable = (BucketP *)malloc(newSize * sizeof(BucketP));
-    if (newTable != NULL)
+    if (table == NULL)
     {
-        // Set the Buckets in the new Table.
-        if (setTableBuckets(newTable, newSize, pTable -> freeKey))
-        {
-            for (int i = INITIAL_INDEX; i < (int)currentSize; i++)
-            {
-                assert((i * RESIZE_FACTOR) < (int)newSize);
-                freeBucket(newTable[i * RESIZE_FACTOR], pTable -> freeKey);
-                newTable[i * RESIZE_FACTOR] = (pTable -> table)[i];
-            }
-
-            // Update the Hash Table size.
-            (pTable -> tableSize) = newSize;
-            updateSizeFactor(pTable);
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
 
-            // Release the old Table.
-            free(pTable -> table);
-            pTable -> table = newTable;
-            return true;
-        }
-        free(newTable);
+    // If the given indices are negative, there is no need to search.
+    if (listNode < INITIAL_INDEX || arrCell < INITIAL_INDEX)
+    {
+        return NULL;
     }
-    return false;
+    return getDataAt64(table, (size_t)arrCell, (size_t)listNode);
 }
 
 /**
- * @brief Allocate memory for a Hash Table with which uses the given functions.
- *        If run out of memory, free all the memory that was already allocated by the function,
- *        report error MEM_OUT to the standard error and return NULL.
- * @param tableSize The number of cells in the hash table.
- * @param cloneKey A pointer for the Key Cloning function.
- * @param freeKey A pointer for the Free Key function.
- * @param hfun A pointer for the Hash function.
- * @param printKeyFun A pointer for the Print Key function.
- * @param printDataFun A pointer for the Print Data function.
- * @param fcomp A pointer for the Key Comparison function.
- * @return A pointer for the new allocated Hash Table if allocation was successful,
- *         otherwise return NULL.
+ * @brief Return the pointer to the key that exist in the table in cell number arrCell
+ *        (where 0 is the first cell), and placement at listNode in the list
+ *        (when 0 is the first node in the list, i.e. the node that is pointed from the
+ *        table itself). If such key not exist return NULL
+ * @param table A pointer to the Table to search.
+ * @param arrCell The cell number in the Hash Table.
+ * @param listNode The placement of the Element in the specific cell number.
+ * @return A pointer to the key in the desired place, if such key not exist return NULL.
  */
-TableP createTable(size_t tableSize, CloneKeyFcn cloneKey, FreeKeyFcn freeKey, HashFcn hfun,
-                   PrintKeyFcn printKeyFun, PrintDataFcn printDataFun, ComparisonFcn fcomp)
+ConstKeyP getKeyAt64(const TableP table, size_t arrCell, size_t listNode)
 {
-    TableP pTable = NULL;
-
-    if (tableSize < MINIMAL_TABLE_SIZE)
+    if (table == NULL)
     {
         reportError(GENERAL_ERROR);
         return NULL;
     }
 
-    if (cloneKey == NULL || freeKey == NULL || hfun == NULL
-        || printKeyFun == NULL || printDataFun == NULL || fcomp == NULL)
+    // If the given cell is out of bounds, there is no need to search.
+    if (arrCell >= getNumberOfCells(table))
     {
-        // If some function input is invalid, we can't continue our program.
-        reportError(GENERAL_ERROR);
         return NULL;
     }
 
-    pTable = initializeTable(tableSize, cloneKey, freeKey, hfun, printKeyFun,
-                             printDataFun, fcomp);
-    if (pTable == NULL)
+    ConstKeyP foundKey = NULL;
+    if ((table -> engine) != CHAINED_ENGINE)
     {
-        // If some part of the memory allocation for the Hash Table was failed.
-        reportError(MEM_OUT);
+        SlotP pSlot = reachSlot(table, arrCell, listNode);
+        if (pSlot != NULL)
+        {
+            foundKey = pSlot -> key;
+        }
+        return foundKey;
     }
 
-    return pTable;
+    ElementP pElement = NULL;
+    pElement = reachElement(table, arrCell, listNode);
+    if (pElement != NULL)
+    {
+        foundKey = pElement -> key;
+    }
+    return foundKey;
 }
 
 /**
- * @brief Insert an object to the Hash Table with key.
- *        If all the cells appropriate for this object are full, duplicate the table.
- *        If run out of memory, report MEM_OUT and do nothing (the table should stay at
- *        the same situation as it was before the duplication).
- *        If everything is OK, return true, otherwise (an error occurred) return false.
- * @param table A pointer for the Hash Table to insert to.
- * @param key The key to insert.
- * @param object The object that is stored by the given key.
- * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ * @brief Return the pointer to the key that exist in the table in cell number arrCell
+ *        (where 0 is the first cell), and placement at listNode in the list
+ *        (when 0 is the first node in the list, i.e. the node that is pointed from the
+ *        table itself). If such key not exist return NULL
+ * @param table A pointer to the Table to search.
+ * @param arrCell The cell number in the Hash Table.
+ * @param listNode The placement of the Element in the specific cell number.
+ * @return A pointer to the key in the desired place, if such key not exist return NULL.
  */
-int insert(TableP table, const void *key, DataP object)
+ConstKeyP getKeyAt(const TableP table, int arrCell, int listNode)
 {
-    if (table == NULL || key == NULL || object == NULL)
+    if (table == NULL)
     {
         reportError(GENERAL_ERROR);
-        return false;
+        return NULL;
+    }
+
+    // If the given indices are negative, there is no need to search.
+    if (listNode < INITIAL_INDEX || arrCell < INITIAL_INDEX)
+    {
+        return NULL;
     }
+    return getKeyAt64(table, (size_t)arrCell, (size_t)listNode);
+}
+
+/**
+ * @brief Returns the index of the Slot after the first empty Slot of the Robin Hood Hash Table,
+ *        from which an iterator walks the Slots. A Table always keeps an empty Slot.
+ * @param pTable A pointer to the Robin Hood Hash Table.
+ * @return The index of the first Slot to walk.
+ */
+static size_t getRobinHoodIterStart(const TableP pTable)
+{
+    assert(pTable != NULL && (pTable -> engine) == ROBIN_HOOD_ENGINE);
 
-    // If the given key is already exists in the Hash Table, we replace it's data with the new data.
-    int arrCell = INVALID_INDEX;
-    int listNode = INVALID_INDEX;
-    if (findData(table, key, &arrCell, &listNode))
+    for (size_t i = INITIAL_INDEX; i < (pTable -> tableSize); i++)
     {
-        if ((arrCell != INVALID_INDEX) && (listNode != INVALID_INDEX))
+        if ((getSlot(pTable -> slots, pTable -> slotSize, i) -> key) == NULL)
         {
-            ElementP pElement = reachElement(table, arrCell, listNode);
-            assert(pElement != NULL);
-            pElement -> data = object;
-            return true;
+            return getNextSlotIndex(i, pTable -> tableSize);
         }
     }
+    return INITIAL_INDEX;
+}
+
+/**
+ * @brief Returns the index of the current Slot of the given iterator of a Robin Hood or cuckoo
+ *        Hash Table.
+ * @param iter A pointer to the iterator.
+ * @return The index of the Slot.
+ */
+static inline size_t getIterSlotIndex(const TableIterP iter)
+{
+    assert(iter != NULL);
 
-    // Generate the Hash Code for the given key.
-    int hashCode = generateHashCode(table, key);
-    // If the Hash Code is lower than the lower bound, it means there was an error and
-    // we can't continue with the insertion process.
-    if (hashCode < HASH_CODE_LOWER_BOUND)
+    if ((iter -> pTable -> engine) == ROBIN_HOOD_ENGINE)
     {
-        reportError(GENERAL_ERROR);
-        return false;
+        return ((iter -> firstSlot) + (iter -> position)) % (iter -> pTable -> tableSize);
     }
-    assert(hashCode <= (int)(table -> tableSize) - 1);
+    return iter -> position;
+}
 
-    BucketP currentBucket = NULL;
-    // Iterate through the possible Buckets to insert.
-    for (int i = INITIAL_INDEX; i < (table -> sizeFactor); i++)
+/**
+ * @brief Move the iterator of a chained Hash Table to it's next Element. Once the cells of the
+ *        current Table are done, the old cells of an incremental resize follow, from the first
+ *        one that was not moved yet.
+ * @param iter A pointer to the iterator.
+ * @return true if the iterator is on an Element, false if the Table is done.
+ */
+static bool chainedIterAdvance(TableIterP iter)
+{
+    assert(iter != NULL);
+
+    TableP pTable = iter -> pTable;
+    if ((iter -> link) != NULL && (iter -> hasCurrent))
     {
-        currentBucket = (table -> table)[hashCode + i];
-        assert(currentBucket != NULL);
+        iter -> link = &((*(iter -> link)) -> next);
+        (iter -> listNode)++;
+    }
 
-        if ((currentBucket -> numberOfElements) < (currentBucket -> bucketSize))
+    while ((iter -> link) == NULL || *(iter -> link) == NULL)
+    {
+        if ((iter -> link) != NULL)
         {
-            // If we enter this Scope, the current Bucket has place to store the new Element.
-
-            // Clone the key.
-            KeyP cloneKey = NULL;
-            cloneKey = (table -> cloneKey)(key);
-            if (cloneKey == NULL)
-            {
-                // The cloneKey function already reports of MEM_OUT.
-                return false;
-            }
-
-            if (!bucketInsertElement(currentBucket, cloneKey, object))
+            (iter -> position)++;
+        }
+        if ((iter -> position) >= (iter -> numberOfCells))
+        {
+            if ((iter -> inOldTable) || (pTable -> oldTable) == NULL)
             {
-                // If 'bucketInsertElement' return false, it means that there
-                // wasn't enough memory to allocate the new Element.
-                reportError(MEM_OUT);
                 return false;
             }
-            return true;
+            iter -> cells = pTable -> oldTable;
+            iter -> numberOfCells = pTable -> oldSize;
+            iter -> position = pTable -> migrationIndex;
+            iter -> inOldTable = true;
+            iter -> link = NULL;
+            continue;
         }
+        iter -> link = &((iter -> cells)[iter -> position].head);
+        iter -> listNode = INITIAL_INDEX;
     }
-
-    // If all the associated Buckets are not available, we have to resize the Hash Table.
-    if (resizeTable(table))
-    {
-        // Attempt to try again inserting the new key.
-        return (insert(table, key, object));
-    }
-    else
-    {
-        // If 'resizeTable' return false, it means that there
-        // wasn't enough memory to allocate the new Table.
-        reportError(MEM_OUT);
-        return false;
-    }
+    return true;
 }
 
 /**
- * @brief Remove a data from the Hash Table.
- *        If everything is OK, return the pointer to the ejected data, otherwise return NULL.
- * @param table A pointer for the Hash Table to remove from.
- * @param key The key to remove.
- * @return pointer to the ejected data if the remove process succeed, otherwise return NULL.
+ * @brief Move the iterator of a Robin Hood or cuckoo Hash Table to it's next Slot which holds
+ *        an object.
+ * @param iter A pointer to the iterator.
+ * @return true if the iterator is on an object, false if the Table is done.
  */
-DataP removeData(TableP table, const void *key)
+static bool slotsIterAdvance(TableIterP iter)
 {
-    if (table == NULL || key == NULL)
+    assert(iter != NULL);
+
+    TableP pTable = iter -> pTable;
+    if (iter -> hasCurrent)
     {
-        reportError(GENERAL_ERROR);
-        return NULL;
+        (iter -> position)++;
     }
 
-    DataP removedData = NULL;
-
-    // Track the desired Element to remove.
-    int arrCell = INVALID_INDEX;
-    int listNode = INVALID_INDEX;
-    if (findData(table, key, &arrCell, &listNode))
+    size_t numberOfSlots = getNumberOfSlots(pTable);
+    while ((iter -> position) < numberOfSlots)
     {
-        if ((arrCell != INVALID_INDEX) && (listNode != INVALID_INDEX))
+        if ((getSlot(pTable -> slots, pTable -> slotSize, getIterSlotIndex(iter)) -> key) != NULL)
         {
-            BucketP currentBucket = NULL;
-            currentBucket = (table -> table)[arrCell];
-            assert(currentBucket != NULL);
-
-            removedData = bucketRemoveElement(currentBucket, key, table -> fcomp, table -> freeKey);
+            return true;
         }
+        (iter -> position)++;
     }
-    return removedData;
+    return false;
 }
 
 /**
- * @brief Search the table and look for an object with the given key.
- *        If such object is found fill its cell number into arrCell (where 0 is the first cell),
- *        and its placement in the list into listNode (when 0 is the first node in the list,
- *        i.e. the node that is pointed from the table itself).
- *        If the key was not found, fill both pointers with value of -1.
- * @param table A pointer for the Hash Table to search in.
- * @param key The key to search.
- * @param arrCell A pointer to update with the proper cell number.
- * @param listNode A pointer to update with the proper Node placement.
- * @return A pointer to the data if found, otherwise return NULL.
+ * @brief Create an iterator over the objects of the given Hash Table, which is placed before
+ *        the first object. A full walk with tableIterNext visits each object once in O(n) total.
+ *        The Table must not change during the walk, other than by tableIterRemove. A search
+ *        moves the cells of an incremental resize, so it is also a change.
+ *        If run out of memory, report MEM_OUT and return NULL.
+ * @param table A pointer to the Hash Table.
+ * @return A pointer to the new iterator, or NULL if the process failed.
  */
-DataP findData(const TableP table, const void *key, int *arrCell, int *listNode)
+TableIterP tableIterBegin(TableP table)
 {
-    if (table == NULL || key == NULL || arrCell == NULL || listNode == NULL)
+    if (table == NULL)
     {
         reportError(GENERAL_ERROR);
         return NULL;
     }
 
-    DataP foundData = NULL;
-    *arrCell = INVALID_INDEX;
-    *listNode = INVALID_INDEX;
-
-    // Generate the Hash Code for the given key.
-    int hashCode = generateHashCode(table, key);
-    // If the Hash Code is lower than the lower bound, it means there was an error and
-    // we can't continue with the search process.
-    if (hashCode < HASH_CODE_LOWER_BOUND)
+    TableIterP iter = (TableIterP)malloc(sizeof(TableIter));
+    if (iter == NULL)
     {
-        reportError(GENERAL_ERROR);
+        reportError(MEM_OUT);
         return NULL;
     }
-    assert(hashCode <= (int)(table -> tableSize) - 1);
-
-    BucketP currentBucket = NULL;
-    // Iterate through the possible Buckets to search.
-    for (int i = INITIAL_INDEX; i < (table -> sizeFactor); i++)
+    iter -> pTable = table;
+    iter -> cells = table -> table;
+    iter -> numberOfCells = table -> tableSize;
+    iter -> inOldTable = false;
+    iter -> position = INITIAL_INDEX;
+    iter -> firstSlot = INITIAL_INDEX;
+    iter -> link = NULL;
+    iter -> listNode = INITIAL_INDEX;
+    iter -> hasCurrent = false;
+    iter -> finished = false;
+    if ((table -> engine) == ROBIN_HOOD_ENGINE)
     {
-        // Find the proper Bucket to search the key.
-        currentBucket = (table -> table)[hashCode + i];
-        assert(currentBucket != NULL);
-
-        // Search inside the current Bucket.
-        foundData = bucketFindData(currentBucket, key, listNode, table -> fcomp);
-        if (foundData != NULL)
-        {
-            *arrCell = hashCode + i;
-            break;
-        }
+        iter -> firstSlot = getRobinHoodIterStart(table);
     }
-    return foundData;
+    return iter;
 }
 
 /**
- * @brief Return a pointer to the data that exist in the table in cell number arrCell
- *        (where 0 is the first cell), and placement at listNode in the list
- *        (when 0 is the first node in the list, i.e. the node that is pointed from the
- *        table itself). If such data not exist return NULL
- * @param table A pointer to the Table to search.
- * @param arrCell The cell number in the Hash Table.
- * @param listNode The placement of the Element in the specific cell number.
- * @return A pointer to the data in the desired place, if such data not exist return NULL.
+ * @brief Move the iterator to the next object of it's Hash Table, and fill it's key and data.
+ * @param iter A pointer to the iterator.
+ * @param key A pointer to update with the key of the object, or NULL.
+ * @param data A pointer to update with the data of the object, or NULL.
+ * @return true (non-zero value) if the iterator moved to an object, false (zero value) if all
+ *         the objects were visited.
  */
-DataP getDataAt(const TableP table, int arrCell, int listNode)
+int tableIterNext(TableIterP iter, ConstKeyP *key, DataP *data)
 {
-    if (table == NULL)
+    if (iter == NULL)
     {
         reportError(GENERAL_ERROR);
-        return NULL;
+        return false;
+    }
+    if (iter -> finished)
+    {
+        return false;
     }
 
-    // If the given indices are out of bounds, there is no need to search.
-    if (listNode < INITIAL_INDEX || arrCell < INITIAL_INDEX
-        || arrCell > (int)(table -> tableSize) - 1)
+    TableP pTable = iter -> pTable;
+    bool advanced = ((pTable -> engine) == CHAINED_ENGINE) ? chainedIterAdvance(iter) :
+                    slotsIterAdvance(iter);
+    iter -> hasCurrent = advanced;
+    iter -> finished = !advanced;
+    if (!advanced)
     {
-        return NULL;
+        return false;
     }
 
-    DataP foundData = NULL;
-    ElementP pElement = NULL;
-    pElement = reachElement(table, arrCell, listNode);
-    if (pElement != NULL)
+    ConstKeyP currentKey = NULL;
+    DataP currentData = NULL;
+    if ((pTable -> engine) == CHAINED_ENGINE)
     {
-        foundData = pElement -> data;
+        currentKey = (*(iter -> link)) -> key;
+        currentData = (*(iter -> link)) -> data;
     }
-    return foundData;
+    else
+    {
+        SlotP pSlot = getSlot(pTable -> slots, pTable -> slotSize, getIterSlotIndex(iter));
+        currentKey = pSlot -> key;
+        currentData = pSlot -> data;
+    }
+
+    if (key != NULL)
+    {
+        *key = currentKey;
+    }
+    if (data != NULL)
+    {
+        *data = currentData;
+    }
+    return true;
 }
 
 /**
- * @brief Return the pointer to the key that exist in the table in cell number arrCell
- *        (where 0 is the first cell), and placement at listNode in the list
- *        (when 0 is the first node in the list, i.e. the node that is pointed from the
- *        table itself). If such key not exist return NULL
- * @param table A pointer to the Table to search.
- * @param arrCell The cell number in the Hash Table.
- * @param listNode The placement of the Element in the specific cell number.
- * @return A pointer to the key in the desired place, if such key not exist return NULL.
+ * @brief Remove the object which the iterator returned last from it's Hash Table. The walk goes
+ *        on with the next object, and still visits every other object once.
+ *        The Table does not resize, so it may shrink only on a later removeData.
+ *        If the iterator is not on an object, report GENERAL_ERROR and return NULL.
+ * @param iter A pointer to the iterator.
+ * @return A pointer for the ejected data, or NULL if the process failed.
  */
-ConstKeyP getKeyAt(const TableP table, int arrCell, int listNode)
+DataP tableIterRemove(TableIterP iter)
 {
-    if (table == NULL)
+    if (iter == NULL || !(iter -> hasCurrent))
     {
         reportError(GENERAL_ERROR);
         return NULL;
     }
 
-    // If the given indices are out of bounds, there is no need to search.
-    if (listNode < INITIAL_INDEX || arrCell < INITIAL_INDEX
-        || arrCell > (int)(table -> tableSize) - 1)
+    TableP pTable = iter -> pTable;
+    DataP removedData = NULL;
+    if ((pTable -> engine) == ROBIN_HOOD_ENGINE)
     {
-        return NULL;
+        // The following Slots shift back, so the next one to visit is now in the current Slot.
+        removedData = robinHoodRemoveSlot(pTable, getIterSlotIndex(iter));
     }
-
-    ConstKeyP foundKey = NULL;
-    ElementP pElement = NULL;
-    pElement = reachElement(table, arrCell, listNode);
-    if (pElement != NULL)
+    else if ((pTable -> engine) == CUCKOO_ENGINE)
     {
-        foundKey = pElement -> key;
+        // No object is taken back from the stash, which the iterator may have passed.
+        removedData = cuckooRemoveSlot(pTable, getIterSlotIndex(iter));
     }
-    return foundKey;
+    else
+    {
+        removedData = bucketUnlinkElement(&((iter -> cells)[iter -> position]), iter -> link,
+                                          iter -> listNode, pTable -> freeKey,
+                                          pTable -> elementPool);
+        (pTable -> numberOfElements)--;
+    }
+    iter -> hasCurrent = false;
+    return removedData;
+}
+
+/**
+ * @brief Free the memory allocated for the iterator. The Hash Table is not changed.
+ *        If the given iterator is NULL, no operation is performed.
+ * @param iter A pointer to the iterator to free.
+ */
+void tableIterEnd(TableIterP iter)
+{
+    free(iter);
 }
 
 /**
@@ -955,18 +4772,26 @@ void freeTable(TableP table)
 {
     if (table != NULL)
     {
+        freeSlots(table);
+
         if (table -> table != NULL)
         {
-            // Free each Bucket and each Element in the Hash Table.
-            for (int i = INITIAL_INDEX; i < (int)(table -> tableSize); i++)
-            {
-                freeBucket((table -> table)[i], table -> freeKey);
-                (table -> table)[i] = NULL;
-            }
-
+            // Free each key in the Hash Table, the Elements are freed by their Pool.
+            freeCellsKeys(table, table -> table, table -> tableSize);
             free(table -> table);
             table -> table = NULL;
         }
+
+        if (table -> oldTable != NULL)
+        {
+            // Free the cells of an incremental resize that were not moved yet.
+            freeCellsKeys(table, table -> oldTable, table -> oldSize);
+            free(table -> oldTable);
+            table -> oldTable = NULL;
+        }
+
+        freeMemoryPool(table -> elementPool);
+        releaseKeyArena(table);
         free(table);
     }
 }
@@ -984,15 +4809,34 @@ void printTable(const TableP table)
     else
     {
         BucketP currentBucket = NULL;
-        for (int i = INITIAL_INDEX; i < (int)(table -> tableSize); i++)
+        for (size_t i = INITIAL_INDEX; i < getNumberOfCells(table); i++)
         {
-            // Print the current Bucket.
-            currentBucket = (table -> table)[i];
-            assert(currentBucket != NULL);
             printf(CELL_PRINT, i);
 
-            // Print Bucket's Elements.
-            printBucket(currentBucket, table -> printKeyFun, table -> printDataFun);
+            if ((table -> engine) != CHAINED_ENGINE)
+            {
+                // Print the Slots of the cell which hold an object.
+                size_t cellSlots = ((table -> engine) == CUCKOO_ENGINE) ? CUCKOO_BUCKET_SLOTS : 1;
+                for (size_t j = INITIAL_INDEX; j < cellSlots; j++)
+                {
+                    SlotP pSlot = reachSlot(table, i, j);
+                    if (pSlot != NULL)
+                    {
+                        printEntry(pSlot -> key, pSlot -> data, table -> printKeyFun,
+                                   table -> printDataFun);
+                    }
+                }
+                printf(END_OF_CELL_PRINT);
+                continue;
+            }
+
+            // Print the current Bucket.
+            currentBucket = getCellBucket(table, i);
+            if (currentBucket != NULL)
+            {
+                // Print Bucket's Elements.
+                printBucket(currentBucket, table -> printKeyFun, table -> printDataFun);
+            }
 
             printf(END_OF_CELL_PRINT);
         }
@@ -2,10 +2,59 @@
 #define _GENERIC_HASH_TABLE_
 #include <stdbool.h>
 #include "Key.h"
+#include "MemoryPool.h"
+#include "KeyArena.h"
 
 typedef void* DataP;
 typedef struct Table* TableP;
 typedef const void* ConstKeyP;
+typedef struct TableIter* TableIterP;
+
+/*! This is GrowthMode enum  */
+typedef enum
+{
+	SPAN_GROWTH, /*!< resize keeps the cell of each object, lookups scan a growing span of cells */
+	REHASH_GROWTH, /*!< resize redistributes the objects by hfun(key, newSize) */
+	INCREMENTAL_GROWTH /*!< like REHASH_GROWTH, but each operation moves only a few cells */
+
+} GrowthMode;
+
+/*! This is TableEngine enum  */
+typedef enum
+{
+	CHAINED_ENGINE, /*!< cells of buckets, each bucket holds a list of objects */
+	ROBIN_HOOD_ENGINE, /*!< one flat array of slots, Robin Hood linear probing (always rehashes) */
+	CUCKOO_ENGINE /*!< cells of 4 slots, a key is in one of two cells or a small stash (always rehashes) */
+
+} TableEngine;
+
+/**
+ * @brief per-table options for createTableWithOptions.
+ * Always fill it with setDefaultTableOptions before changing single fields.
+ */
+typedef struct TableOptions
+{
+	TableEngine engine; /*!< how the objects are stored, CHAINED_ENGINE by default */
+	GrowthMode growthMode; /*!< how the table grows, SPAN_GROWTH by default */
+	ArenaAllocFcn arenaAlloc; /*!< allocates the slabs of the table nodes from arena, NULL for malloc */
+	ArenaFreeFcn arenaFree; /*!< releases a slab of table nodes to arena, may be NULL */
+	void *arena; /*!< the user arena given to arenaAlloc and arenaFree */
+	size_t inlineKeySize; /*!< keys up to this size are copied into the table instead of cloneKey, 0 by default */
+	KeySizeFcn keySize; /*!< returns the size of a key, NULL when all keys are inlineKeySize bytes */
+	size_t bucketCapacity; /*!< objects held by a cell before SPAN_GROWTH grows or a rehashed cell overflows */
+	double maxLoadFactor; /*!< objects per cell at which a rehashed or Robin Hood table grows, and a cuckoo table is sized for, 0 for the engine default */
+	size_t growthFactor; /*!< the factor the table size is multiplied by when it grows, at least 2 */
+	double minLoadFactor; /*!< objects per cell under which the table shrinks by growthFactor, 0 to never shrink */
+	size_t expectedElements; /*!< the table is created with room for this many objects, as with reserveTable */
+	HashFcn64 hfun64; /*!< the 64 bit hash of a key, used instead of hfun when not NULL, hfun may then be NULL */
+	SeededHashFcn seededHfun; /*!< a keyed hash, seeded at random per table, which defends the table from crafted keys, NULL by default */
+	size_t floodChainLength; /*!< a chained table switches to seededHfun once a key is searched in this many objects, 0 to use it from the start */
+	bool arenaKeys; /*!< keys are copied with keySize into a key arena of the table instead of cloneKey, false by default */
+	bool internKeys; /*!< equal keys share their copy in the key arena of the table, false by default */
+	KeyArenaP keyArena; /*!< a key arena shared with other tables, used instead of a key arena of the table, NULL by default */
+	size_t resizeThreads; /*!< threads that rehash the cells of a large chained table when it grows, 1 by default */
+
+} TableOptions;
 
 /**
  * @brief print function
@@ -23,6 +72,62 @@ TableP createTable(size_t tableSize, CloneKeyFcn cloneKey, FreeKeyFcn freeKey
 					 		  ,HashFcn hfun,PrintKeyFcn printKeyFun, PrintDataFcn printDataFun
 					 		  , ComparisonFcn fcomp);
 
+/**
+ * @brief Fill the given options with the defaults used by createTable.
+ */
+void setDefaultTableOptions(TableOptions *options);
+
+/**
+ * @brief Same as createTable, but the table behaves as described by the given options.
+ * SPAN_GROWTH tables give the exact cell indices of createTable, REHASH_GROWTH tables
+ * keep a lookup at a single cell no matter how many times the table has grown, the cell
+ * of a key is hfun(key, INT_MAX) mixed and scaled to the table size, so growing never calls
+ * hfun and keys that differ only in their low bits do not crowd together.
+ * INCREMENTAL_GROWTH tables keep the cells that were not moved yet after a resize as extra
+ * cells, numbered from the current size on, until insert, removeData and findData move them.
+ * In a ROBIN_HOOD_ENGINE table every cell is a single slot, so listNode is always 0.
+ * In a CUCKOO_ENGINE table every cell holds up to 4 objects, and a lookup searches at most
+ * two cells and a stash, which is the extra cell numbered as the table size. The table
+ * grows only when no chain of displacements frees a slot for a new key. No more than 12 keys
+ * may share a full hash code, so the table needs an hfun64 or a seededHfun, and a table with
+ * only an hfun is rejected.
+ * With an hfun64 the cell of a key is it's 64 bit hash mixed and scaled to the table size,
+ * also in a SPAN_GROWTH table, so the table may hold more than 2^31 cells, whose cell and
+ * node positions are given by findData64, getDataAt64 and getKeyAt64.
+ * With a seededHfun a chained table hashes it's keys by it, under a random seed drawn for the
+ * table, once an insert finds floodChainLength objects in the cells of it's key, i.e. a chain
+ * or a SPAN_GROWTH span that long. All the objects are then rehashed, and a SPAN_GROWTH table
+ * becomes a REHASH_GROWTH table, so crafted keys can not force long chains or repeated resizes.
+ * Robin Hood and cuckoo tables, and a floodChainLength of 0, use seededHfun from the start,
+ * and then hfun may be NULL.
+ * With arenaKeys or a keyArena, a key that is not inline is copied into the arena, as keySize
+ * bytes, and freeKey is never called. The arena of the table is released by freeTable at once,
+ * a shared keyArena must be released with freeKeyArena after all of it's tables were freed.
+ * If the options are invalid report GENERAL_ERROR and return NULL.
+ */
+TableP createTableWithOptions(size_t tableSize, const TableOptions *options, CloneKeyFcn cloneKey
+							  , FreeKeyFcn freeKey, HashFcn hfun, PrintKeyFcn printKeyFun
+							  , PrintDataFcn printDataFun, ComparisonFcn fcomp);
+
+/**
+ * @brief Grow the table once, so expectedElements objects would be inserted without any
+ * further resize. A SPAN_GROWTH table keeps growing by growthFactor, and the objects are
+ * assumed to spread evenly over it's cells.
+ * If run out of memory, report MEM_OUT and leave the table as it was.
+ * If everything is OK, return true. Otherwise (an error occured) return false;
+ */
+int reserveTable(TableP table, size_t expectedElements);
+
+/**
+ * @brief Shrink the table to the smallest size that holds it's current objects, never below
+ * it's original size, and move the nodes of a chained table into fresh memory.
+ * A SPAN_GROWTH table shrinks only as far as the objects of each original cell fit in the
+ * shorter span of cells. An incremental resize in progress is completed first.
+ * If run out of memory, report MEM_OUT and leave the table valid.
+ * If everything is OK, return true. Otherwise (an error occured) return false;
+ */
+int compactTable(TableP table);
+
 /**
  * @brief Insert an object to the table with key.
  * If all the cells appropriate for this object are full, duplicate the table.
@@ -34,6 +139,22 @@ TableP createTable(size_t tableSize, CloneKeyFcn cloneKey, FreeKeyFcn freeKey
 int  insert( TableP table, const void* key, DataP object);   /* was FIXED here **/
 // int  insert( TableP table, const void* key, DataP object);
 
+/**
+ * @brief Insert an object to the table with key, or replace the object of the key if it is
+ * already in the table. The key is hashed once and each chain is walked once.
+ * If previous is not NULL, it is filled with the replaced object, or NULL if the key is new.
+ * If everything is OK, return true. Otherwise (an error occured) return false;
+ */
+int upsert(TableP table, const void* key, DataP object, DataP* previous);
+
+/**
+ * @brief return a pointer to the data of the key in the table. If the key is not in the
+ * table, insert it with defaultData first. The data may be updated through the pointer
+ * until the next insert or remove on the table.
+ * If an error occured return NULL;
+ */
+DataP* getOrInsert(TableP table, const void* key, DataP defaultData);
+
 /**
  * @brief remove an data from the table.
  * If everything is OK, return the pointer to the ejected data. Otherwise return NULL;
@@ -46,11 +167,63 @@ DataP removeData(TableP table, const void* key);
  * first cell), and its placement in the list into listNode (when 0 is the
  * first node in the list, i.e. the node that is pointed from the table
  * itself).
- * If the key was not found, fill both pointers with value of -1.
+ * If the key was not found, or its position does not fit in an int, fill both pointers
+ * with value of -1.
  * return pointer to the data or null
  */
 DataP findData(const TableP table, const void* key, int* arrCell, int* listNode);
 
+/**
+ * @brief Same as findData, but with the cell and node positions of any table size.
+ * If the key was not found, fill both pointers with SIZE_MAX.
+ * return pointer to the data or null
+ */
+DataP findData64(const TableP table, const void* key, size_t* arrCell, size_t* listNode);
+
+/**
+ * @brief Search the table for each of the numberOfKeys keys, and fill the data of each key,
+ * or null if it is not found, into the same place in results.
+ * The keys are handled in groups whose hash codes are generated and whose cells are
+ * prefetched first, so the memory accesses of a group overlap.
+ * A null key reports GENERAL_ERROR and it's result is null.
+ * return the number of keys that were found.
+ */
+size_t findDataBatch(const TableP table, const void* const* keys, size_t numberOfKeys,
+					 DataP* results);
+
+/**
+ * @brief Insert each of the numberOfKeys keys to the table with the object in the same place
+ * in objects, replacing the object of a key that is already in the table. The keys are
+ * handled in groups, as in findDataBatch.
+ * Stops at the first key that could not be inserted, the keys before it stay in the table.
+ * If everything is OK, return true. Otherwise (an error occured) return false;
+ */
+int insertBatch(TableP table, const void* const* keys, const DataP* objects, size_t numberOfKeys);
+
+/**
+ * @brief Create a table as createTableWithOptions does, sized once for numberOfKeys objects, and
+ * insert each of the numberOfKeys keys with the object in the same place in objects, as
+ * insertBatch does, using up to numberOfThreads threads.
+ * The keys are hashed in parallel, ordered by ranges of cells, and each range is filled by a
+ * single thread without locks. Only chained REHASH_GROWTH and INCREMENTAL_GROWTH tables without
+ * a key arena, whose seededHfun (if any) is used from the start, are built in parallel, any other
+ * table is filled with insertBatch. cloneKey, keySize and the hash and comparison functions must
+ * be safe to call from several threads at once.
+ * If an error occured, free the table, report the error and return NULL.
+ */
+TableP buildTableParallel(const void* const* keys, const DataP* objects, size_t numberOfKeys,
+						  size_t numberOfThreads, size_t tableSize, const TableOptions* options,
+						  CloneKeyFcn cloneKey, FreeKeyFcn freeKey, HashFcn hfun,
+						  PrintKeyFcn printKeyFun, PrintDataFcn printDataFun, ComparisonFcn fcomp);
+
+/**
+ * @brief remove each of the numberOfKeys keys from the table, and if removed is not null fill
+ * the ejected data of each key, or null if it is not found, into the same place in removed.
+ * The keys are handled in groups, as in findDataBatch.
+ * return the number of keys that were removed.
+ */
+size_t removeDataBatch(TableP table, const void* const* keys, size_t numberOfKeys, DataP* removed);
+
 /**
  * @brief return a pointer to the data that exist in the table in cell number arrCell (where 0 is the
  * first cell), and placment at listNode in the list (when 0 is the
@@ -60,6 +233,11 @@ DataP findData(const TableP table, const void* key, int* arrCell, int* listNode)
  */
 DataP getDataAt(const TableP table, int arrCell, int listNode);
 
+/**
+ * @brief Same as getDataAt, but with the cell and node positions of any table size.
+ */
+DataP getDataAt64(const TableP table, size_t arrCell, size_t listNode);
+
 /**
  * @brief return the pointer to the key that exist in the table in cell number arrCell (where 0 is the
  * first cell), and placment at listNode in the list (when 0 is the
@@ -69,6 +247,40 @@ DataP getDataAt(const TableP table, int arrCell, int listNode);
  */
 ConstKeyP getKeyAt(const TableP, int arrCell, int listNode);
 
+/**
+ * @brief Same as getKeyAt, but with the cell and node positions of any table size.
+ */
+ConstKeyP getKeyAt64(const TableP table, size_t arrCell, size_t listNode);
+
+/**
+ * @brief Create an iterator over the objects of the table, placed before the first object.
+ * Walking the whole table with tableIterNext visits each object once, in O(n) total, unlike
+ * calling getDataAt or getKeyAt for every position.
+ * The table must not change during the walk, other than by tableIterRemove. A search in an
+ * INCREMENTAL_GROWTH table moves cells, so it is a change too.
+ * If run out of memory, report MEM_OUT and return NULL.
+ */
+TableIterP tableIterBegin(TableP table);
+
+/**
+ * @brief Move the iterator to the next object, and fill it's key and data into key and data,
+ * each of them may be NULL.
+ * return true if the iterator moved to an object, false once all the objects were visited.
+ */
+int tableIterNext(TableIterP iter, ConstKeyP* key, DataP* data);
+
+/**
+ * @brief Remove the object which tableIterNext returned last from the table, and return it's data.
+ * The walk goes on with the next object. The table does not shrink during the walk.
+ * If the iterator is not on an object, report GENERAL_ERROR and return NULL.
+ */
+DataP tableIterRemove(TableIterP iter);
+
+/**
+ * @brief Free the iterator. The table is not changed.
+ */
+void tableIterEnd(TableIterP iter);
+
 /**
  * @brief Print the table (use the format presented in PrintTableExample).
  */
@@ -0,0 +1,1250 @@
+/**
+ * @file GenericTableTester.c
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Tester for the Generic Hash Table.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Tester for the Generic Hash Table.
+ * Input:       No particular input.
+ * Process:     Checks that a table of each engine finds, removes and inserts again every key
+ *              while it grows, and that the nodes of a table are allocated from it's arena and
+ *              all released with it. Checks that inline keys are never cloned,
+ *              and that upsert and getOrInsert replace and insert objects as they should.
+ *              Checks that a table shrinks, by it's min load factor or by compactTable, and
+ *              that the batch functions agree with the single key ones. Checks long chains of
+ *              keys whose tags or whole Hash Codes are shared. Checks that a cuckoo table holds
+ *              many string keys whose int Hash Codes collide, and rejects an int Hash function.
+ *              Checks that interned keys keep their place in the arena when they are inserted
+ *              again, also by another table which shares the arena.
+ *              Checks that LenStr keys are cloned with their chars by each engine.
+ *              Checks SipHash against it's reference vectors, and that a chained table flooded
+ *              by anagrams which collide under strFcn switches to it and spreads them out.
+ *              Checks that the mixing Hash functions stay in an int for a huge table size.
+ *              Checks that a Typed Hash Table grows, and shifts back the entries after a
+ *              removed one.
+ *              Checks that a table which grows by several threads, and a table which is built by
+ *              several threads, place every key in the same cell and node as a table which grows
+ *              by a single thread and as insertBatch. Checks that an iterator visits every
+ *              object of each engine once, and removes the objects it is asked to.
+ * Output:      The result of each check, and EXIT_FAILURE if any of them failed.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <limits.h>
+#include "GenericHashTable.h"
+#include "KeyArena.h"
+#include "TypedHashTable.h"
+#include "MyIntFunctions.h"
+#include "MyStringFunctions.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def NUMBER_OF_KEYS 200000
+ * @brief A Macro that sets the number of keys inserted by each check, enough for a table to
+ *        grow past the cells a single thread rehashes.
+ */
+#define NUMBER_OF_KEYS 200000
+
+/**
+ * @def NUMBER_OF_THREADS 4
+ * @brief A Macro that sets the number of threads which work on a single table.
+ */
+#define NUMBER_OF_THREADS 4
+
+/**
+ * @def INITIAL_TABLE_SIZE 64
+ * @brief A Macro that sets the number of cells of a tested table.
+ */
+#define INITIAL_TABLE_SIZE 64
+
+/**
+ * @def KEY_MULTIPLIER 2654435761
+ * @brief A Macro that sets the multiplier which scatters the tested keys.
+ */
+#define KEY_MULTIPLIER 2654435761u
+
+/**
+ * @def REPEATED_KEY_STEP 7
+ * @brief A Macro that sets the step between the keys which repeat the key before them.
+ */
+#define REPEATED_KEY_STEP 7
+
+/**
+ * @def ROUND_TRIP_KEYS 20000
+ * @brief A Macro that sets the number of keys inserted by a round trip check.
+ */
+#define ROUND_TRIP_KEYS 20000
+
+/**
+ * @def KEPT_KEYS 100
+ * @brief A Macro that sets the number of keys left in a table which is checked to shrink.
+ */
+#define KEPT_KEYS 100
+
+/**
+ * @def MIN_SHRINK 8
+ * @brief A Macro that sets the least factor by which the cells of a shrunk table must fall.
+ */
+#define MIN_SHRINK 8
+
+/**
+ * @def SHRINK_LOAD_FACTOR 0.25
+ * @brief A Macro that sets the min load factor of a table which shrinks by itself.
+ */
+#define SHRINK_LOAD_FACTOR 0.25
+
+/**
+ * @def CROWDED_LOAD_FACTOR 32
+ * @brief A Macro that sets the max load factor and the bucket capacity of a table whose
+ *        chains are longer than the tags of a Bucket.
+ */
+#define CROWDED_LOAD_FACTOR 32
+
+/**
+ * @def SHARED_HASH_CODES 1024
+ * @brief A Macro that sets the number of distinct Hash Codes given by sharedHash64.
+ */
+#define SHARED_HASH_CODES 1024
+
+/**
+ * @def ANAGRAM_LENGTH 6
+ * @brief A Macro that sets the length of the anagrams inserted to a cuckoo table.
+ */
+#define ANAGRAM_LENGTH 6
+
+/**
+ * @def NUMBER_OF_ANAGRAMS 720
+ * @brief A Macro that sets the number of anagrams of ANAGRAM_LENGTH distinct letters.
+ */
+#define NUMBER_OF_ANAGRAMS 720
+
+/**
+ * @def ANAGRAM_LETTERS "abcdef"
+ * @brief A Macro that sets the letters of the anagrams.
+ */
+#define ANAGRAM_LETTERS "abcdef"
+
+/**
+ * @def REMOVED_KEY_STEP 2
+ * @brief A Macro that sets the step between the keys an iterator removes.
+ */
+#define REMOVED_KEY_STEP 2
+
+/**
+ * @def SIP_TEST_KEY_0 0x0706050403020100
+ * @brief A Macro that sets the first word of the key of the SipHash reference vectors.
+ */
+#define SIP_TEST_KEY_0 UINT64_C(0x0706050403020100)
+
+/**
+ * @def SIP_TEST_KEY_1 0x0F0E0D0C0B0A0908
+ * @brief A Macro that sets the second word of the key of the SipHash reference vectors.
+ */
+#define SIP_TEST_KEY_1 UINT64_C(0x0F0E0D0C0B0A0908)
+
+/**
+ * @def SIP_EMPTY_HASH 0x726FDB47DD0E0E31
+ * @brief A Macro that sets the reference SipHash-2-4 of an empty input.
+ */
+#define SIP_EMPTY_HASH UINT64_C(0x726FDB47DD0E0E31)
+
+/**
+ * @def SIP_VECTOR_LENGTH 15
+ * @brief A Macro that sets the length of the reference input whose bytes are 0, 1, 2 and so on.
+ */
+#define SIP_VECTOR_LENGTH 15
+
+/**
+ * @def SIP_VECTOR_HASH 0xA129CA6149BE45E5
+ * @brief A Macro that sets the reference SipHash-2-4 of the input of SIP_VECTOR_LENGTH bytes.
+ */
+#define SIP_VECTOR_HASH UINT64_C(0xA129CA6149BE45E5)
+
+/**
+ * @def FLOOD_CHAIN_LENGTH 8
+ * @brief A Macro that sets the flood chain length of a table which is flooded by anagrams.
+ */
+#define FLOOD_CHAIN_LENGTH 8
+
+/**
+ * @def MIN_SEEDED_CELLS 180
+ * @brief A Macro that sets the least number of cells which hold the kept anagrams once a
+ *        flooded table hashes them by a seeded Hash function.
+ */
+#define MIN_SEEDED_CELLS (NUMBER_OF_ANAGRAMS / 4)
+
+
+/*-----=  Globals  =-----*/
+
+
+/**
+ * @brief The number of keys cloned or freed by countingCloneInt and countingFreeInt.
+ */
+static size_t keyCopies = 0;
+
+
+/*-----=  Structs  =-----*/
+
+
+/**
+ * @brief A Structure representing a user arena which counts the slabs it allocates and
+ *        releases.
+ */
+typedef struct CountingArena
+{
+    size_t allocatedSlabs;
+    size_t releasedSlabs;
+} CountingArena;
+
+/**
+ * @brief A Typed Hash Table which maps int keys to int values.
+ */
+DEFINE_HASH_TABLE(IntMap, int, int, typedIntHash, typedIntEquals)
+
+
+/*-----=  Test Functions  =-----*/
+
+
+/**
+ * @brief Fills the given arrays with NUMBER_OF_KEYS scattered keys and their objects.
+ * @param keyValues The values of the keys.
+ * @param keys The pointers to the keys.
+ * @param objects The objects of the keys, which are the keys themselves.
+ */
+static void fillKeys(int *keyValues, const void **keys, DataP *objects)
+{
+    for (size_t i = 0; i < NUMBER_OF_KEYS; i++)
+    {
+        keyValues[i] = (int)((i * KEY_MULTIPLIER) % INT32_MAX);
+        keys[i] = &keyValues[i];
+        objects[i] = &keyValues[i];
+    }
+}
+
+/**
+ * @brief Checks that every key is found with it's object in the same cell and node of both
+ *        given tables.
+ * @param first A pointer to the first table.
+ * @param second A pointer to the second table.
+ * @param keys The pointers to the keys.
+ * @param objects The objects of the keys.
+ * @return true if the check passed, false otherwise.
+ */
+static bool samePlacement(TableP first, TableP second, const void **keys, const DataP *objects)
+{
+    for (size_t i = 0; i < NUMBER_OF_KEYS; i++)
+    {
+        size_t firstCell = SIZE_MAX;
+        size_t firstNode = SIZE_MAX;
+        size_t secondCell = SIZE_MAX;
+        size_t secondNode = SIZE_MAX;
+        if (findData64(first, keys[i], &firstCell, &firstNode) != objects[i]
+            || findData64(second, keys[i], &secondCell, &secondNode) != objects[i]
+            || firstCell != secondCell || firstNode != secondNode)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Inserts ROUND_TRIP_KEYS scattered keys to the given table, removes every
+ *        REMOVED_KEY_STEP key and inserts them again, and checks after each step that exactly
+ *        the keys which should be in the table are found, each with it's own object.
+ * @param table A pointer to an empty table of int keys.
+ * @return true if the check passed, false otherwise.
+ */
+static bool roundTrip(TableP table)
+{
+    static int keyValues[ROUND_TRIP_KEYS];
+    static int missingKeys[ROUND_TRIP_KEYS];
+    bool passed = table != NULL;
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        keyValues[i] = (int)((i * KEY_MULTIPLIER) % INT32_MAX);
+        missingKeys[i] = -1 - keyValues[i];
+        passed = insert(table, &keyValues[i], &keyValues[i]);
+    }
+
+    size_t arrCell = SIZE_MAX;
+    size_t listNode = SIZE_MAX;
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        passed = findData64(table, &keyValues[i], &arrCell, &listNode) == &keyValues[i]
+                 && findData64(table, &missingKeys[i], &arrCell, &listNode) == NULL;
+    }
+
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i += REMOVED_KEY_STEP)
+    {
+        passed = removeData(table, &keyValues[i]) == &keyValues[i]
+                 && removeData(table, &keyValues[i]) == NULL;
+    }
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        DataP expected = (i % REMOVED_KEY_STEP == 0) ? NULL : &keyValues[i];
+        passed = findData64(table, &keyValues[i], &arrCell, &listNode) == expected;
+    }
+
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i += REMOVED_KEY_STEP)
+    {
+        passed = insert(table, &keyValues[i], &keyValues[i]);
+    }
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        passed = findData64(table, &keyValues[i], &arrCell, &listNode) == &keyValues[i];
+    }
+    return passed;
+}
+
+/**
+ * @brief Runs a round trip on a table of the given engine and growth mode, whose keys are
+ *        hashed by intFcn.
+ * @param engine The engine of the table.
+ * @param growthMode The growth mode of the table.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testRoundTrip(TableEngine engine, GrowthMode growthMode)
+{
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.engine = engine;
+    options.growthMode = growthMode;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneInt, freeInt,
+                                          intFcn, intPrint, intPrint, intCompare);
+    bool passed = roundTrip(table);
+    freeTable(table);
+    return passed;
+}
+
+/**
+ * @brief Allocate a slab from the given counting arena.
+ * @param arena A pointer to the CountingArena.
+ * @param size The size of the slab in bytes.
+ * @return A pointer to the slab, or NULL if out of memory.
+ */
+static void *countingAlloc(void *arena, size_t size)
+{
+    ((CountingArena *)arena) -> allocatedSlabs++;
+    return malloc(size);
+}
+
+/**
+ * @brief Release a slab to the given counting arena.
+ * @param arena A pointer to the CountingArena.
+ * @param block The slab to release.
+ */
+static void countingFree(void *arena, void *block)
+{
+    ((CountingArena *)arena) -> releasedSlabs++;
+    free(block);
+}
+
+/**
+ * @brief Runs a round trip on a chained table whose nodes come from a counting arena, and
+ *        checks that the table allocated slabs from it and released all of them when freed.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testArenaPools()
+{
+    CountingArena arena = {0, 0};
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.growthMode = REHASH_GROWTH;
+    options.arenaAlloc = countingAlloc;
+    options.arenaFree = countingFree;
+    options.arena = &arena;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneInt, freeInt,
+                                          intFcn, intPrint, intPrint, intCompare);
+    bool passed = roundTrip(table);
+    freeTable(table);
+    return passed && arena.allocatedSlabs > 0 && arena.releasedSlabs == arena.allocatedSlabs;
+}
+
+/**
+ * @brief Clones an int key as cloneInt does, and counts it.
+ * @param key The key to clone.
+ * @return The clone key, or NULL if out of memory.
+ */
+static void *countingCloneInt(const void *key)
+{
+    keyCopies++;
+    return cloneInt(key);
+}
+
+/**
+ * @brief Frees an int key as freeInt does, and counts it.
+ * @param key The key to free.
+ */
+static void countingFreeInt(void *key)
+{
+    keyCopies++;
+    freeInt(key);
+}
+
+/**
+ * @brief Runs a round trip on a table of the given engine whose int keys are stored inline,
+ *        and checks that no key was cloned or freed by the key functions.
+ * @param engine The engine of the table.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testInlineKeys(TableEngine engine)
+{
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.engine = engine;
+    options.growthMode = REHASH_GROWTH;
+    options.hfun64 = intMixFcn64;
+    options.inlineKeySize = sizeof(int);
+    keyCopies = 0;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, countingCloneInt,
+                                          countingFreeInt, NULL, intPrint, intPrint, intCompare);
+    bool passed = roundTrip(table);
+    freeTable(table);
+    return passed && keyCopies == 0;
+}
+
+/**
+ * @brief Upserts, updates through getOrInsert and removes ROUND_TRIP_KEYS keys in a table of
+ *        the given engine and growth mode, and checks that each call replaces, inserts and
+ *        returns the objects it should.
+ * @param engine The engine of the table.
+ * @param growthMode The growth mode of the table.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testUpsert(TableEngine engine, GrowthMode growthMode)
+{
+    static int keyValues[ROUND_TRIP_KEYS];
+    static int firstObjects[ROUND_TRIP_KEYS];
+    static int secondObjects[ROUND_TRIP_KEYS];
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.engine = engine;
+    options.growthMode = growthMode;
+    options.hfun64 = intMixFcn64;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneInt, freeInt, NULL,
+                                          intPrint, intPrint, intCompare);
+
+    bool passed = table != NULL;
+    DataP previous = NULL;
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        keyValues[i] = (int)((i * KEY_MULTIPLIER) % INT32_MAX);
+        passed = upsert(table, &keyValues[i], &firstObjects[i], &previous) && previous == NULL;
+    }
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        passed = upsert(table, &keyValues[i], &secondObjects[i], &previous)
+                 && previous == &firstObjects[i];
+    }
+
+    // Every REMOVED_KEY_STEP key is removed, so getOrInsert inserts it again.
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i += REMOVED_KEY_STEP)
+    {
+        passed = removeData(table, &keyValues[i]) == &secondObjects[i];
+    }
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        DataP *data = getOrInsert(table, &keyValues[i], &firstObjects[i]);
+        DataP expected = (i % REMOVED_KEY_STEP == 0) ? &firstObjects[i] : &secondObjects[i];
+        passed = data != NULL && *data == expected;
+        if (passed)
+        {
+            *data = &keyValues[i];
+        }
+    }
+
+    size_t arrCell = SIZE_MAX;
+    size_t listNode = SIZE_MAX;
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        passed = findData64(table, &keyValues[i], &arrCell, &listNode) == &keyValues[i];
+    }
+    freeTable(table);
+    return passed;
+}
+
+/**
+ * @brief Returns the highest cell of the first numberOfKeys of the given keys in the table.
+ * @param table A pointer to the table, which holds all the keys.
+ * @param keyValues The keys.
+ * @param numberOfKeys The number of keys.
+ * @return The highest cell, or SIZE_MAX if a key is not found.
+ */
+static size_t getHighestCell(TableP table, const int *keyValues, size_t numberOfKeys)
+{
+    size_t highestCell = 0;
+    for (size_t i = 0; i < numberOfKeys; i++)
+    {
+        size_t arrCell = SIZE_MAX;
+        size_t listNode = SIZE_MAX;
+        if (findData64(table, &keyValues[i], &arrCell, &listNode) == NULL)
+        {
+            return SIZE_MAX;
+        }
+        highestCell = (arrCell > highestCell) ? arrCell : highestCell;
+    }
+    return highestCell;
+}
+
+/**
+ * @brief Grows a table of the given engine by ROUND_TRIP_KEYS keys and removes all but
+ *        KEPT_KEYS of them, and checks that the cells of the kept keys fell by MIN_SHRINK at
+ *        least. The table shrinks by itself with a min load factor, otherwise by compactTable.
+ * @param engine The engine of the table.
+ * @param useMinLoadFactor Whether the table shrinks by it's min load factor.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testShrink(TableEngine engine, bool useMinLoadFactor)
+{
+    static int keyValues[ROUND_TRIP_KEYS];
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.engine = engine;
+    options.growthMode = REHASH_GROWTH;
+    options.hfun64 = intMixFcn64;
+    options.minLoadFactor = useMinLoadFactor ? SHRINK_LOAD_FACTOR : 0;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneInt, freeInt, NULL,
+                                          intPrint, intPrint, intCompare);
+
+    bool passed = table != NULL;
+    for (size_t i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        keyValues[i] = (int)((i * KEY_MULTIPLIER) % INT32_MAX);
+        passed = insert(table, &keyValues[i], &keyValues[i]);
+    }
+    size_t grownCell = passed ? getHighestCell(table, keyValues, ROUND_TRIP_KEYS) : 0;
+
+    for (size_t i = KEPT_KEYS; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        passed = removeData(table, &keyValues[i]) == &keyValues[i];
+    }
+    passed = passed && (useMinLoadFactor || compactTable(table));
+    size_t shrunkCell = passed ? getHighestCell(table, keyValues, KEPT_KEYS) : SIZE_MAX;
+    freeTable(table);
+    return passed && grownCell != SIZE_MAX && shrunkCell <= grownCell / MIN_SHRINK;
+}
+
+/**
+ * @brief Inserts ROUND_TRIP_KEYS keys to a table of the given engine by insertBatch, searches
+ *        them and as many missing keys by findDataBatch, and removes every REMOVED_KEY_STEP
+ *        key of both by removeDataBatch, and checks the result of every key.
+ * @param engine The engine of the table.
+ * @param growthMode The growth mode of the table.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testBatch(TableEngine engine, GrowthMode growthMode)
+{
+    // The first half of the keys is inserted, the second half is missing.
+    static int keyValues[2 * ROUND_TRIP_KEYS];
+    static const void *keys[2 * ROUND_TRIP_KEYS];
+    static DataP objects[2 * ROUND_TRIP_KEYS];
+    static DataP results[2 * ROUND_TRIP_KEYS];
+    for (size_t i = 0; i < 2 * ROUND_TRIP_KEYS; i++)
+    {
+        int keyValue = (int)((i * KEY_MULTIPLIER) % INT32_MAX);
+        keyValues[i] = (i < ROUND_TRIP_KEYS) ? keyValue : -1 - keyValue;
+        keys[i] = &keyValues[i];
+        objects[i] = &keyValues[i];
+    }
+
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.engine = engine;
+    options.growthMode = growthMode;
+    options.hfun64 = intMixFcn64;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneInt, freeInt, NULL,
+                                          intPrint, intPrint, intCompare);
+    bool passed = table != NULL
+                  && insertBatch(table, keys, objects, ROUND_TRIP_KEYS)
+                  && findDataBatch(table, keys, 2 * ROUND_TRIP_KEYS, results) == ROUND_TRIP_KEYS;
+    for (size_t i = 0; passed && i < 2 * ROUND_TRIP_KEYS; i++)
+    {
+        passed = results[i] == ((i < ROUND_TRIP_KEYS) ? objects[i] : NULL);
+    }
+
+    // Every REMOVED_KEY_STEP key is gathered to the start of the array and removed.
+    static const void *removedKeys[2 * ROUND_TRIP_KEYS / REMOVED_KEY_STEP];
+    for (size_t i = 0; i < 2 * ROUND_TRIP_KEYS; i += REMOVED_KEY_STEP)
+    {
+        removedKeys[i / REMOVED_KEY_STEP] = keys[i];
+    }
+    size_t numberOfRemoved = 2 * ROUND_TRIP_KEYS / REMOVED_KEY_STEP;
+    passed = passed && removeDataBatch(table, removedKeys, numberOfRemoved, results)
+                       == ROUND_TRIP_KEYS / REMOVED_KEY_STEP;
+    for (size_t i = 0; passed && i < numberOfRemoved; i++)
+    {
+        size_t index = i * REMOVED_KEY_STEP;
+        passed = results[i] == ((index < ROUND_TRIP_KEYS) ? objects[index] : NULL);
+    }
+
+    passed = passed && findDataBatch(table, keys, 2 * ROUND_TRIP_KEYS, results)
+                       == ROUND_TRIP_KEYS - ROUND_TRIP_KEYS / REMOVED_KEY_STEP;
+    for (size_t i = 0; passed && i < 2 * ROUND_TRIP_KEYS; i++)
+    {
+        bool found = i < ROUND_TRIP_KEYS && i % REMOVED_KEY_STEP != 0;
+        passed = results[i] == (found ? objects[i] : NULL);
+    }
+    freeTable(table);
+    return passed;
+}
+
+/**
+ * @brief A 64 bit Hash function which gives only SHARED_HASH_CODES Hash Codes, so many keys
+ *        share their whole Hash Code and their tag.
+ * @param key The int key.
+ * @return The Hash Code of the key.
+ */
+static uint64_t sharedHash64(const void *key)
+{
+    return intMixFcn64(key) % SHARED_HASH_CODES;
+}
+
+/**
+ * @brief Runs a round trip on a chained table whose chains hold about CROWDED_LOAD_FACTOR
+ *        keys, more than the tags of a Bucket, hashed by the given function.
+ * @param hfun64 The 64 bit Hash function of the table.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testCrowdedChains(HashFcn64 hfun64)
+{
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.growthMode = REHASH_GROWTH;
+    options.hfun64 = hfun64;
+    options.maxLoadFactor = CROWDED_LOAD_FACTOR;
+    options.bucketCapacity = CROWDED_LOAD_FACTOR;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneInt, freeInt, NULL,
+                                          intPrint, intPrint, intCompare);
+    bool passed = roundTrip(table);
+    freeTable(table);
+    return passed;
+}
+
+/**
+ * @brief Fills the given array with all the anagrams of ANAGRAM_LETTERS, the i-th of them
+ *        given by the digits of i in the factorial number system.
+ * @param anagrams The array to fill.
+ */
+static void fillAnagrams(char anagrams[NUMBER_OF_ANAGRAMS][ANAGRAM_LENGTH + 1])
+{
+    for (size_t i = 0; i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        char letters[] = ANAGRAM_LETTERS;
+        size_t index = i;
+        for (size_t j = 0; j < ANAGRAM_LENGTH; j++)
+        {
+            size_t remaining = ANAGRAM_LENGTH - j;
+            size_t chosen = index % remaining;
+            index /= remaining;
+            anagrams[i][j] = letters[chosen];
+            for (size_t k = chosen; k + 1 < remaining; k++)
+            {
+                letters[k] = letters[k + 1];
+            }
+        }
+        anagrams[i][ANAGRAM_LENGTH] = '\0';
+    }
+}
+
+/**
+ * @brief Inserts all the anagrams of ANAGRAM_LETTERS, which share their strFcn Hash Code, to
+ *        a cuckoo table hashed by the given functions, removes every REMOVED_KEY_STEP of them,
+ *        and checks that exactly the kept ones are found.
+ * @param hfun64 The 64 bit Hash function of the table, or NULL.
+ * @param seededHfun The seeded Hash function of the table, or NULL.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testCuckooAnagrams(HashFcn64 hfun64, SeededHashFcn seededHfun)
+{
+    static char anagrams[NUMBER_OF_ANAGRAMS][ANAGRAM_LENGTH + 1];
+    fillAnagrams(anagrams);
+    bool passed = true;
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        passed = strFcn(anagrams[i], INT_MAX) == strFcn(anagrams[0], INT_MAX);
+    }
+
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.engine = CUCKOO_ENGINE;
+    options.hfun64 = hfun64;
+    options.seededHfun = seededHfun;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneStr, freeStr,
+                                          strFcn, strPrint, strPrint, strCompare);
+    passed = passed && table != NULL;
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        passed = insert(table, anagrams[i], anagrams[i]);
+    }
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i += REMOVED_KEY_STEP)
+    {
+        passed = removeData(table, anagrams[i]) == anagrams[i];
+    }
+
+    size_t arrCell = SIZE_MAX;
+    size_t listNode = SIZE_MAX;
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        DataP expected = (i % REMOVED_KEY_STEP == 0) ? NULL : anagrams[i];
+        passed = findData64(table, anagrams[i], &arrCell, &listNode) == expected;
+    }
+    freeTable(table);
+    return passed;
+}
+
+/**
+ * @brief Checks that a cuckoo table with only an int Hash function is rejected.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testCuckooRejectsIntHash()
+{
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.engine = CUCKOO_ENGINE;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneStr, freeStr,
+                                          strFcn, strPrint, strPrint, strCompare);
+    freeTable(table);
+    return table == NULL;
+}
+
+/**
+ * @brief Checks that the mixing Hash functions give every key and anagram a Hash Code between
+ *        0 and INT_MAX for a Table whose size does not fit an int.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testHugeTableSize()
+{
+    static char anagrams[NUMBER_OF_ANAGRAMS][ANAGRAM_LENGTH + 1];
+    fillAnagrams(anagrams);
+    bool passed = true;
+    for (int i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        int key = (int)(i * KEY_MULTIPLIER);
+        passed = intMixFcn(&key, SIZE_MAX) >= 0;
+    }
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        LenStr key = makeLenStr(anagrams[i]);
+        passed = strMixFcn(anagrams[i], SIZE_MAX) >= 0 && lenStrFcn(&key, SIZE_MAX) >= 0;
+    }
+    return passed;
+}
+
+/**
+ * @brief Inserts ROUND_TRIP_KEYS scattered keys to a Typed Hash Table which starts with the
+ *        least number of entries, removes every REMOVED_KEY_STEP of them, so the entries after
+ *        each of them are shifted back, and checks that exactly the kept ones are found before
+ *        the removed ones are inserted again. Also checks that a Table with more entries than a
+ *        size_t counts is not created.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testTypedTable()
+{
+    IntMap *table = IntMapCreate(0);
+    bool passed = table != NULL && IntMapCreate(SIZE_MAX) == NULL;
+    for (int i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        passed = IntMapInsert(table, (int)(i * KEY_MULTIPLIER), i);
+    }
+    passed = passed && IntMapCount(table) == ROUND_TRIP_KEYS;
+
+    for (int i = 0; passed && i < ROUND_TRIP_KEYS; i += REMOVED_KEY_STEP)
+    {
+        int removed = -1;
+        passed = IntMapRemove(table, (int)(i * KEY_MULTIPLIER), &removed) && removed == i
+                 && !IntMapRemove(table, (int)(i * KEY_MULTIPLIER), NULL);
+    }
+    for (int i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        const int *value = IntMapFind(table, (int)(i * KEY_MULTIPLIER));
+        passed = (i % REMOVED_KEY_STEP == 0) ? value == NULL : value != NULL && *value == i;
+    }
+
+    for (int i = 0; passed && i < ROUND_TRIP_KEYS; i += REMOVED_KEY_STEP)
+    {
+        passed = IntMapInsert(table, (int)(i * KEY_MULTIPLIER), -i);
+    }
+    for (int i = 0; passed && i < ROUND_TRIP_KEYS; i++)
+    {
+        const int *value = IntMapFind(table, (int)(i * KEY_MULTIPLIER));
+        passed = value != NULL && *value == ((i % REMOVED_KEY_STEP == 0) ? -i : i);
+    }
+    passed = passed && IntMapCount(table) == ROUND_TRIP_KEYS;
+    IntMapFree(table);
+    return passed;
+}
+
+/**
+ * @brief Inserts all the anagrams of ANAGRAM_LETTERS to a table which interns it's keys in it's
+ *        arena, removes them and inserts equal copies of them, and checks that every copy
+ *        is held in the place the first anagram was, since an interned key is never copied
+ *        again.
+ * @param engine The engine of the table.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testInternedKeys(TableEngine engine)
+{
+    static char anagrams[NUMBER_OF_ANAGRAMS][ANAGRAM_LENGTH + 1];
+    static char copies[NUMBER_OF_ANAGRAMS][ANAGRAM_LENGTH + 1];
+    static ConstKeyP storedKeys[NUMBER_OF_ANAGRAMS];
+    fillAnagrams(anagrams);
+    fillAnagrams(copies);
+
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.engine = engine;
+    options.growthMode = REHASH_GROWTH;
+    options.hfun64 = strMixFcn64;
+    options.keySize = strKeySize;
+    options.arenaKeys = true;
+    options.internKeys = true;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneStr, freeStr, NULL,
+                                          strPrint, strPrint, strCompare);
+    bool passed = table != NULL;
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        size_t arrCell = SIZE_MAX;
+        size_t listNode = SIZE_MAX;
+        passed = insert(table, anagrams[i], anagrams[i])
+                 && findData64(table, anagrams[i], &arrCell, &listNode) == anagrams[i];
+        storedKeys[i] = passed ? getKeyAt64(table, arrCell, listNode) : NULL;
+        passed = passed && storedKeys[i] != anagrams[i];
+    }
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        passed = removeData(table, anagrams[i]) == anagrams[i]
+                 && insert(table, copies[i], copies[i]);
+    }
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        size_t arrCell = SIZE_MAX;
+        size_t listNode = SIZE_MAX;
+        passed = findData64(table, anagrams[i], &arrCell, &listNode) == copies[i]
+                 && getKeyAt64(table, arrCell, listNode) == storedKeys[i];
+    }
+    freeTable(table);
+    return passed;
+}
+
+/**
+ * @brief Inserts all the anagrams of ANAGRAM_LETTERS to a chained table and equal copies of
+ *        them to a Robin Hood table, which share an interning key arena, and checks that both
+ *        tables hold every key in the same place, and the second table adds nothing to the
+ *        arena.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testSharedKeyArena()
+{
+    static char anagrams[NUMBER_OF_ANAGRAMS][ANAGRAM_LENGTH + 1];
+    static char copies[NUMBER_OF_ANAGRAMS][ANAGRAM_LENGTH + 1];
+    fillAnagrams(anagrams);
+    fillAnagrams(copies);
+
+    KeyArenaP arena = createKeyArena(true);
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.growthMode = REHASH_GROWTH;
+    options.hfun64 = strMixFcn64;
+    options.keySize = strKeySize;
+    options.keyArena = arena;
+    TableP chainedTable = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneStr, freeStr,
+                                                 NULL, strPrint, strPrint, strCompare);
+    options.engine = ROBIN_HOOD_ENGINE;
+    TableP robinHoodTable = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneStr,
+                                                   freeStr, NULL, strPrint, strPrint,
+                                                   strCompare);
+
+    bool passed = arena != NULL && chainedTable != NULL && robinHoodTable != NULL;
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        passed = insert(chainedTable, anagrams[i], anagrams[i]);
+    }
+    size_t usedBytes = passed ? arenaUsedBytes(arena) : 0;
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        passed = insert(robinHoodTable, copies[i], copies[i]);
+    }
+    passed = passed && arenaUsedBytes(arena) == usedBytes;
+
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        size_t chainedCell = SIZE_MAX;
+        size_t chainedNode = SIZE_MAX;
+        size_t robinHoodCell = SIZE_MAX;
+        size_t robinHoodNode = SIZE_MAX;
+        passed = findData64(chainedTable, copies[i], &chainedCell, &chainedNode) == anagrams[i]
+                 && findData64(robinHoodTable, anagrams[i], &robinHoodCell,
+                               &robinHoodNode) == copies[i]
+                 && getKeyAt64(chainedTable, chainedCell, chainedNode)
+                    == getKeyAt64(robinHoodTable, robinHoodCell, robinHoodNode);
+    }
+    freeTable(chainedTable);
+    freeTable(robinHoodTable);
+    freeKeyArena(arena);
+    return passed;
+}
+
+/**
+ * @brief Inserts all the anagrams of ANAGRAM_LETTERS as LenStr keys, cloned by cloneLenStr,
+ *        to a table of the given engine, and overwrites the chars they were made of. Removes
+ *        every REMOVED_KEY_STEP of them, and checks that exactly the kept ones are found by
+ *        keys made of equal chars.
+ * @param engine The engine of the table.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testLenStrKeys(TableEngine engine)
+{
+    static char anagrams[NUMBER_OF_ANAGRAMS][ANAGRAM_LENGTH + 1];
+    static char copies[NUMBER_OF_ANAGRAMS][ANAGRAM_LENGTH + 1];
+    fillAnagrams(copies);
+
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.engine = engine;
+    options.growthMode = REHASH_GROWTH;
+    options.hfun64 = lenStrFcn64;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneLenStr, freeLenStr,
+                                          lenStrFcn, lenStrPrint, strPrint, lenStrCompare);
+    bool passed = table != NULL;
+    fillAnagrams(anagrams);
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        LenStr key = makeLenStr(anagrams[i]);
+        passed = insert(table, &key, copies[i]);
+    }
+    for (size_t i = 0; i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        anagrams[i][0] = '\0';
+    }
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i += REMOVED_KEY_STEP)
+    {
+        LenStr key = makeLenStr(copies[i]);
+        passed = removeData(table, &key) == copies[i];
+    }
+
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        LenStr key = makeLenStr(copies[i]);
+        size_t arrCell = SIZE_MAX;
+        size_t listNode = SIZE_MAX;
+        DataP expected = (i % REMOVED_KEY_STEP == 0) ? NULL : copies[i];
+        passed = findData64(table, &key, &arrCell, &listNode) == expected;
+    }
+    freeTable(table);
+    return passed;
+}
+
+/**
+ * @brief Checks strSipFcn and lenStrSipFcn against the reference vectors of SipHash-2-4.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testSipVectors()
+{
+    HashSeed seed = {SIP_TEST_KEY_0, SIP_TEST_KEY_1};
+    char chars[SIP_VECTOR_LENGTH];
+    for (size_t i = 0; i < SIP_VECTOR_LENGTH; i++)
+    {
+        chars[i] = (char)i;
+    }
+    LenStr key = {chars, SIP_VECTOR_LENGTH};
+    return strSipFcn("", &seed) == SIP_EMPTY_HASH && lenStrSipFcn(&key, &seed) == SIP_VECTOR_HASH;
+}
+
+/**
+ * @brief Floods a chained table hashed by strFcn with all the anagrams of ANAGRAM_LETTERS, so
+ *        it switches to strSipFcn, removes every REMOVED_KEY_STEP of them, and checks that
+ *        exactly the kept ones are found, spread over at least MIN_SEEDED_CELLS cells.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testSeededFlood()
+{
+    static char anagrams[NUMBER_OF_ANAGRAMS][ANAGRAM_LENGTH + 1];
+    fillAnagrams(anagrams);
+
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.growthMode = REHASH_GROWTH;
+    options.seededHfun = strSipFcn;
+    options.floodChainLength = FLOOD_CHAIN_LENGTH;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneStr, freeStr,
+                                          strFcn, strPrint, strPrint, strCompare);
+    bool passed = table != NULL;
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        passed = insert(table, anagrams[i], anagrams[i]);
+    }
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i += REMOVED_KEY_STEP)
+    {
+        passed = removeData(table, anagrams[i]) == anagrams[i];
+    }
+
+    static size_t cells[NUMBER_OF_ANAGRAMS];
+    size_t numberOfCells = 0;
+    for (size_t i = 0; passed && i < NUMBER_OF_ANAGRAMS; i++)
+    {
+        size_t arrCell = SIZE_MAX;
+        size_t listNode = SIZE_MAX;
+        DataP expected = (i % REMOVED_KEY_STEP == 0) ? NULL : anagrams[i];
+        passed = findData64(table, anagrams[i], &arrCell, &listNode) == expected;
+        if (expected == NULL)
+        {
+            continue;
+        }
+        size_t j = 0;
+        while (j < numberOfCells && cells[j] != arrCell)
+        {
+            j++;
+        }
+        if (j == numberOfCells)
+        {
+            cells[numberOfCells++] = arrCell;
+        }
+    }
+    freeTable(table);
+    return passed && numberOfCells >= MIN_SEEDED_CELLS;
+}
+
+/**
+ * @brief Grows a table of the given growth mode by a single thread and another one by
+ *        NUMBER_OF_THREADS threads, and checks that they place the keys the same.
+ * @param growthMode The growth mode of the tables.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testParallelResize(GrowthMode growthMode)
+{
+    static int keyValues[NUMBER_OF_KEYS];
+    static const void *keys[NUMBER_OF_KEYS];
+    static DataP objects[NUMBER_OF_KEYS];
+    fillKeys(keyValues, keys, objects);
+
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.growthMode = growthMode;
+    options.hfun64 = intMixFcn64;
+    TableP serialTable = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneInt, freeInt,
+                                                NULL, intPrint, intPrint, intCompare);
+    options.resizeThreads = NUMBER_OF_THREADS;
+    TableP parallelTable = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneInt,
+                                                  freeInt, NULL, intPrint, intPrint, intCompare);
+
+    bool passed = serialTable != NULL && parallelTable != NULL;
+    for (size_t i = 0; passed && i < NUMBER_OF_KEYS; i++)
+    {
+        passed = insert(serialTable, keys[i], objects[i]) && insert(parallelTable, keys[i],
+                                                                    objects[i]);
+    }
+    passed = passed && samePlacement(serialTable, parallelTable, keys, objects);
+    freeTable(serialTable);
+    freeTable(parallelTable);
+    return passed;
+}
+
+/**
+ * @brief Builds a table of the given growth mode by buildTableParallel and another one by
+ *        insertBatch, and checks that they place the keys the same. Some keys are repeated, so
+ *        the last object of a repeated key must win in both tables.
+ * @param growthMode The growth mode of the tables.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testParallelBuild(GrowthMode growthMode)
+{
+    static int keyValues[NUMBER_OF_KEYS];
+    static const void *keys[NUMBER_OF_KEYS];
+    static DataP objects[NUMBER_OF_KEYS];
+    fillKeys(keyValues, keys, objects);
+    for (size_t i = REPEATED_KEY_STEP; i < NUMBER_OF_KEYS; i += REPEATED_KEY_STEP)
+    {
+        keyValues[i] = keyValues[i - 1];
+    }
+
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.growthMode = growthMode;
+    options.hfun64 = intMixFcn64;
+    options.inlineKeySize = sizeof(int);
+    TableP builtTable = buildTableParallel(keys, objects, NUMBER_OF_KEYS, NUMBER_OF_THREADS,
+                                           INITIAL_TABLE_SIZE, &options, cloneInt, freeInt,
+                                           NULL, intPrint, intPrint, intCompare);
+    options.expectedElements = NUMBER_OF_KEYS;
+    TableP batchTable = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneInt, freeInt,
+                                               NULL, intPrint, intPrint, intCompare);
+
+    bool passed = builtTable != NULL && batchTable != NULL
+                  && insertBatch(batchTable, keys, objects, NUMBER_OF_KEYS);
+    for (size_t i = 0; passed && i < NUMBER_OF_KEYS; i++)
+    {
+        // Only the last object of a repeated key is in the tables.
+        size_t lastIndex = i;
+        if (i + 1 < NUMBER_OF_KEYS && (i + 1) % REPEATED_KEY_STEP == 0)
+        {
+            lastIndex = i + 1;
+        }
+        size_t builtCell = SIZE_MAX;
+        size_t builtNode = SIZE_MAX;
+        size_t batchCell = SIZE_MAX;
+        size_t batchNode = SIZE_MAX;
+        passed = findData64(builtTable, keys[i], &builtCell, &builtNode) == objects[lastIndex]
+                 && findData64(batchTable, keys[i], &batchCell, &batchNode) == objects[lastIndex]
+                 && builtCell == batchCell && builtNode == batchNode;
+    }
+    freeTable(builtTable);
+    freeTable(batchTable);
+    return passed;
+}
+
+/**
+ * @brief Walks a table of the given engine and growth mode by an iterator, which removes every
+ *        REMOVED_KEY_STEP key, and checks that each object was visited once and that exactly
+ *        the removed keys are gone from the table.
+ * @param engine The engine of the table.
+ * @param growthMode The growth mode of the table.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testIteratorRemove(TableEngine engine, GrowthMode growthMode)
+{
+    static int keyValues[NUMBER_OF_KEYS];
+    static const void *keys[NUMBER_OF_KEYS];
+    static DataP objects[NUMBER_OF_KEYS];
+    for (size_t i = 0; i < NUMBER_OF_KEYS; i++)
+    {
+        keyValues[i] = (int)i;
+        keys[i] = &keyValues[i];
+        objects[i] = &keyValues[i];
+    }
+
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.engine = engine;
+    options.growthMode = growthMode;
+    options.hfun64 = intMixFcn64;
+    TableP table = createTableWithOptions(INITIAL_TABLE_SIZE, &options, cloneInt, freeInt, NULL,
+                                          intPrint, intPrint, intCompare);
+    bool passed = table != NULL && insertBatch(table, keys, objects, NUMBER_OF_KEYS);
+    TableIterP iter = passed ? tableIterBegin(table) : NULL;
+    passed = passed && iter != NULL;
+
+    static bool visited[NUMBER_OF_KEYS];
+    size_t numberOfVisited = 0;
+    ConstKeyP key = NULL;
+    DataP data = NULL;
+    for (size_t i = 0; i < NUMBER_OF_KEYS; i++)
+    {
+        visited[i] = false;
+    }
+    while (passed && tableIterNext(iter, &key, &data))
+    {
+        size_t index = (size_t)*(const int *)key;
+        passed = index < NUMBER_OF_KEYS && !visited[index] && data == objects[index];
+        if (passed)
+        {
+            visited[index] = true;
+            numberOfVisited++;
+        }
+        if (passed && index % REMOVED_KEY_STEP == 0)
+        {
+            passed = tableIterRemove(iter) == objects[index];
+        }
+    }
+    tableIterEnd(iter);
+    passed = passed && numberOfVisited == NUMBER_OF_KEYS;
+
+    for (size_t i = 0; passed && i < NUMBER_OF_KEYS; i++)
+    {
+        size_t arrCell = SIZE_MAX;
+        size_t listNode = SIZE_MAX;
+        DataP expected = (i % REMOVED_KEY_STEP == 0) ? NULL : objects[i];
+        passed = findData64(table, keys[i], &arrCell, &listNode) == expected;
+    }
+    freeTable(table);
+    return passed;
+}
+
+/**
+ * @brief Prints the result of the given check.
+ * @param name The name of the check.
+ * @param passed Whether the check passed.
+ * @return passed.
+ */
+static bool reportTest(const char *name, bool passed)
+{
+    printf("%s: %s\n", name, passed ? "passed" : "FAILED");
+    return passed;
+}
+
+/**
+ * @brief The main function. Runs the checks of the Generic Hash Table.
+ * @return EXIT_SUCCESS if all the checks passed, EXIT_FAILURE otherwise.
+ */
+int main()
+{
+    bool passed = true;
+    passed &= reportTest("Round trip, Robin Hood", testRoundTrip(ROBIN_HOOD_ENGINE,
+                                                                 REHASH_GROWTH));
+    passed &= reportTest("Round trip, incremental growth",
+                         testRoundTrip(CHAINED_ENGINE, INCREMENTAL_GROWTH));
+    passed &= reportTest("Arena pools", testArenaPools());
+    passed &= reportTest("Inline keys, chained", testInlineKeys(CHAINED_ENGINE));
+    passed &= reportTest("Inline keys, Robin Hood", testInlineKeys(ROBIN_HOOD_ENGINE));
+    passed &= reportTest("Inline keys, cuckoo", testInlineKeys(CUCKOO_ENGINE));
+    passed &= reportTest("Upsert, chained span growth", testUpsert(CHAINED_ENGINE, SPAN_GROWTH));
+    passed &= reportTest("Upsert, chained incremental growth",
+                         testUpsert(CHAINED_ENGINE, INCREMENTAL_GROWTH));
+    passed &= reportTest("Upsert, Robin Hood", testUpsert(ROBIN_HOOD_ENGINE, REHASH_GROWTH));
+    passed &= reportTest("Upsert, cuckoo", testUpsert(CUCKOO_ENGINE, REHASH_GROWTH));
+    passed &= reportTest("Shrink by min load factor", testShrink(CHAINED_ENGINE, true));
+    passed &= reportTest("Shrink by compactTable, chained", testShrink(CHAINED_ENGINE, false));
+    passed &= reportTest("Shrink by compactTable, Robin Hood",
+                         testShrink(ROBIN_HOOD_ENGINE, false));
+    passed &= reportTest("Shrink by compactTable, cuckoo", testShrink(CUCKOO_ENGINE, false));
+    passed &= reportTest("Batch, chained span growth", testBatch(CHAINED_ENGINE, SPAN_GROWTH));
+    passed &= reportTest("Batch, chained incremental growth",
+                         testBatch(CHAINED_ENGINE, INCREMENTAL_GROWTH));
+    passed &= reportTest("Batch, Robin Hood", testBatch(ROBIN_HOOD_ENGINE, REHASH_GROWTH));
+    passed &= reportTest("Batch, cuckoo", testBatch(CUCKOO_ENGINE, REHASH_GROWTH));
+    passed &= reportTest("Tags, crowded chains", testCrowdedChains(intMixFcn64));
+    passed &= reportTest("Tags, shared Hash Codes", testCrowdedChains(sharedHash64));
+    passed &= reportTest("Cuckoo, rejects an int Hash function", testCuckooRejectsIntHash());
+    passed &= reportTest("Cuckoo, anagrams by a 64 bit Hash function",
+                         testCuckooAnagrams(strMixFcn64, NULL));
+    passed &= reportTest("Cuckoo, anagrams by a seeded Hash function",
+                         testCuckooAnagrams(NULL, strSipFcn));
+    passed &= reportTest("Interned keys, chained", testInternedKeys(CHAINED_ENGINE));
+    passed &= reportTest("Interned keys, Robin Hood", testInternedKeys(ROBIN_HOOD_ENGINE));
+    passed &= reportTest("Shared key arena", testSharedKeyArena());
+    passed &= reportTest("LenStr keys, chained", testLenStrKeys(CHAINED_ENGINE));
+    passed &= reportTest("LenStr keys, Robin Hood", testLenStrKeys(ROBIN_HOOD_ENGINE));
+    passed &= reportTest("LenStr keys, cuckoo", testLenStrKeys(CUCKOO_ENGINE));
+    passed &= reportTest("SipHash reference vectors", testSipVectors());
+    passed &= reportTest("Seeded Hash function, anagram flood", testSeededFlood());
+    passed &= reportTest("Hash Codes of a huge table", testHugeTableSize());
+    passed &= reportTest("Typed table", testTypedTable());
+    passed &= reportTest("Parallel resize", testParallelResize(REHASH_GROWTH));
+    passed &= reportTest("Parallel build, rehash growth", testParallelBuild(REHASH_GROWTH));
+    passed &= reportTest("Parallel build, incremental growth",
+                         testParallelBuild(INCREMENTAL_GROWTH));
+    passed &= reportTest("Iterator, chained span growth",
+                         testIteratorRemove(CHAINED_ENGINE, SPAN_GROWTH));
+    passed &= reportTest("Iterator, chained rehash growth",
+                         testIteratorRemove(CHAINED_ENGINE, REHASH_GROWTH));
+    passed &= reportTest("Iterator, Robin Hood", testIteratorRemove(ROBIN_HOOD_ENGINE,
+                                                                   REHASH_GROWTH));
+    passed &= reportTest("Iterator, cuckoo", testIteratorRemove(CUCKOO_ENGINE, REHASH_GROWTH));
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
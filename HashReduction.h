@@ -0,0 +1,85 @@
+#ifndef _HASH_REDUCTION_H_
+#define _HASH_REDUCTION_H_
+
+/**
+ * @file HashReduction.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief An internal Header file for the Hash Tables. It defines how a full Hash Code is
+ *        reduced to a cell of a table, which the Generic and the Concurrent Hash Tables share.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * An internal Header file for the Hash Tables. It defines how a full Hash Code is
+ * reduced to a cell of a table, which the Generic and the Concurrent Hash Tables share.
+ * Input:       No particular input.
+ * Process:     The Hash Code is mixed by a multiplication and it's mixed bits are scaled to the
+ *              table size, so keys fall in the same cells in both tables.
+ * Output:      No particular output.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def HASH_REDUCTION_MULTIPLIER 0x9E3779B1
+ * @brief A Macro that sets the multiplier which mixes a full Hash Code before it is reduced to
+ *        the size of the Hash Table, so Hash Codes that differ only in their low bits, such as
+ *        the Hash Codes of strided ids, are spread over the whole Table.
+ */
+#define HASH_REDUCTION_MULTIPLIER 0x9E3779B1u
+
+/**
+ * @def WIDE_HASH_REDUCTION_MULTIPLIER 0x9E3779B97F4A7C15
+ * @brief A Macro that sets the multiplier which mixes a full Hash Code before it is reduced to
+ *        the size of a Hash Table of more than 2^32 cells.
+ */
+#define WIDE_HASH_REDUCTION_MULTIPLIER UINT64_C(0x9E3779B97F4A7C15)
+
+/**
+ * @def HASH_REDUCTION_SHIFT 32
+ * @brief A Macro that sets the number of bits of a mixed Hash Code.
+ */
+#define HASH_REDUCTION_SHIFT 32
+
+
+/*-----=  Hash Functions  =-----*/
+
+
+/**
+ * @brief Reduces the given full Hash Code to a cell of a Table with the given size.
+ *        The Hash Code is folded to 32 bits, mixed by a multiplication and it's mixed bits are
+ *        scaled to the size, which is much cheaper than a division and does not need a size
+ *        which is a power of 2. A Table of more than 2^32 cells takes the Hash Code mixed in
+ *        64 bits modulo it's size.
+ * @param hashCode The full Hash Code.
+ * @param size The number of cells.
+ * @return A number between 0 - (size-1).
+ */
+static inline size_t reduceHashCode(uint64_t hashCode, size_t size)
+{
+    assert(size > 0);
+
+    if ((uint64_t)size <= ((uint64_t)1 << HASH_REDUCTION_SHIFT))
+    {
+        uint32_t mixedHashCode = (uint32_t)(hashCode ^ (hashCode >> HASH_REDUCTION_SHIFT))
+                                 * HASH_REDUCTION_MULTIPLIER;
+        return (size_t)(((uint64_t)mixedHashCode * size) >> HASH_REDUCTION_SHIFT);
+    }
+    return (size_t)((hashCode * WIDE_HASH_REDUCTION_MULTIPLIER) % size);
+}
+
+#endif // _HASH_REDUCTION_H_
@@ -27,6 +27,7 @@
 
 
 #include <stddef.h>
+#include <stdint.h>
 #include "TableErrorHandle.h"
 
 
@@ -72,6 +73,15 @@
  */
 typedef void *KeyP;
 
+/**
+ * HashSeed is the secret key of a keyed Hash function, which is drawn at random per Hash Table.
+ */
+typedef struct HashSeed
+{
+    uint64_t k0;
+    uint64_t k1;
+} HashSeed;
+
 
 /*-----=  Forward Declarations  =-----*/
 
@@ -99,6 +109,30 @@ typedef void (*FreeKeyFcn)(void * key);
  */
 typedef int (*HashFcn)(const void * key, size_t tableSize);
 
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key, which the Hash Table reduces to
+ *        it's own size, so it may hold more than 2^31 cells.
+ * @param key The key to generate Hash Code to.
+ * @return The Hash Code of the key.
+ */
+typedef uint64_t (*HashFcn64)(const void * key);
+
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key under the given secret seed, so
+ *        keys can not be crafted to collide without knowing the seed.
+ * @param key The key to generate Hash Code to.
+ * @param seed The secret seed of the Hash Table.
+ * @return The Hash Code of the key.
+ */
+typedef uint64_t (*SeededHashFcn)(const void * key, const HashSeed * seed);
+
+/**
+ * @brief Returns the number of bytes which hold the given key, so the key can be copied as is.
+ * @param key The key to measure.
+ * @return The size of the key in bytes.
+ */
+typedef size_t (*KeySizeFcn)(const void * key);
+
 /**
  * @brief Prints the given key to the standard output.
  * @param key The key to print.
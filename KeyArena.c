@@ -0,0 +1,427 @@
+/**
+ * @file KeyArena.c
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A file for the Key Arena. It defines an arena which copies keys of any size
+ *        one after the other into large chunks, and may intern them, so equal keys share a copy.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A file for the Key Arena. It defines an arena which copies keys of any size
+ * one after the other into large chunks, and may intern them, so equal keys share a copy.
+ * Input:       No particular input.
+ * Process:     Each key is preceded by it's size, and each chunk is twice as large as the
+ *              previous one (up to a limit), so millions of short keys need only a few
+ *              allocations. The interned keys are found through an open addressing set
+ *              of their Hash Codes.
+ * Output:      No particular output.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include "KeyArena.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def INITIAL_CHUNK_SIZE 4096
+ * @brief A Macro that sets the number of bytes in the first chunk of a Key Arena.
+ */
+#define INITIAL_CHUNK_SIZE 4096
+
+/**
+ * @def MAX_CHUNK_SIZE 1048576
+ * @brief A Macro that sets the max number of bytes in a chunk of a Key Arena, a larger key
+ *        gets a chunk of it's own.
+ */
+#define MAX_CHUNK_SIZE 1048576
+
+/**
+ * @def CHUNK_GROWTH_FACTOR 2
+ * @brief A Macro that sets the factor in which each chunk is larger than the previous one.
+ */
+#define CHUNK_GROWTH_FACTOR 2
+
+/**
+ * @def INITIAL_INTERN_SLOTS 64
+ * @brief A Macro that sets the number of slots in the first set of interned keys.
+ */
+#define INITIAL_INTERN_SLOTS 64
+
+/**
+ * @def INTERN_GROWTH_FACTOR 2
+ * @brief A Macro that sets the factor in which the set of interned keys grows. The set grows
+ *        once it is more than 1/INTERN_GROWTH_FACTOR full.
+ */
+#define INTERN_GROWTH_FACTOR 2
+
+/**
+ * @def KEY_HASH_MULTIPLIER 0x9E3779B97F4A7C15
+ * @brief A Macro that sets the multiplier which mixes each word of a key into it's Hash Code.
+ */
+#define KEY_HASH_MULTIPLIER UINT64_C(0x9E3779B97F4A7C15)
+
+/**
+ * @def KEY_HASH_SHIFT 32
+ * @brief A Macro that sets the shift which folds the high bits of a Hash Code into it's low bits.
+ */
+#define KEY_HASH_SHIFT 32
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * ChunkP is a pointer for a Chunk of the Key Arena.
+ */
+typedef struct Chunk *ChunkP;
+
+
+/*-----=  Structs  =-----*/
+
+
+/**
+ * @brief A union of the types with the strictest alignment, every key is aligned to it.
+ */
+typedef union KeyAlignment
+{
+    void *pointer;
+    long long integer;
+    long double floating;
+} KeyAlignment;
+
+/**
+ * @brief A union representing the header which precedes each key in the Key Arena, it holds
+ *        the size of the key and keeps the key after it aligned.
+ */
+typedef union KeyHeader
+{
+    size_t keySize;
+    KeyAlignment alignment;
+} KeyHeader;
+
+/**
+ * @brief A Structure representing the header of a Chunk, the keys follow it in memory.
+ *        The Chunks of a Key Arena are linked, so they can all be released at once.
+ */
+typedef struct Chunk
+{
+    ChunkP next;
+    KeyAlignment bytes[];
+} Chunk;
+
+/**
+ * @brief A Structure representing a slot in the set of interned keys, an empty slot has a
+ *        NULL key.
+ */
+typedef struct InternSlot
+{
+    uint64_t hashCode;
+    unsigned char *key;
+} InternSlot;
+
+/**
+ * @brief A Structure representing the Key Arena.
+ *        The Key Arena holds the list of it's Chunks and the unused part of the last Chunk,
+ *        from which the next keys are copied, and the set of interned keys.
+ */
+typedef struct KeyArena
+{
+    ChunkP chunks;
+    unsigned char *nextByte;
+    unsigned char *chunkEnd;
+    size_t chunkSize;
+    size_t usedBytes;
+
+    // Interned Keys.
+    bool internKeys;
+    InternSlot *internSlots;
+    size_t numberOfInternSlots;
+    size_t numberOfInternedKeys;
+} KeyArena;
+
+
+/*-----=  Key Arena Functions  =-----*/
+
+
+/**
+ * @brief Returns the given size rounded up to whole Key Alignment units.
+ * @param size The size in bytes.
+ * @return The aligned size.
+ */
+static inline size_t alignSize(size_t size)
+{
+    return ((size + sizeof(KeyAlignment) - 1) / sizeof(KeyAlignment)) * sizeof(KeyAlignment);
+}
+
+/**
+ * @brief Returns the header which precedes the given copy of a key.
+ * @param storedKey A pointer to the copy of the key.
+ * @return A pointer to the header of the key.
+ */
+static inline const KeyHeader *getKeyHeader(const void *storedKey)
+{
+    assert(storedKey != NULL);
+
+    return (const KeyHeader *)((const unsigned char *)storedKey - sizeof(KeyHeader));
+}
+
+/**
+ * @brief Generates the Hash Code of the given key bytes, mixed 8 bytes at a time.
+ * @param key The key.
+ * @param keySize The size of the key in bytes.
+ * @return The Hash Code of the key.
+ */
+static uint64_t hashKeyBytes(const void *key, size_t keySize)
+{
+    assert(key != NULL || keySize == 0);
+
+    const unsigned char *bytes = (const unsigned char *)key;
+    uint64_t hashCode = (uint64_t)keySize * KEY_HASH_MULTIPLIER;
+    uint64_t word = 0;
+    while (keySize >= sizeof(word))
+    {
+        memcpy(&word, bytes, sizeof(word));
+        hashCode = (hashCode ^ word) * KEY_HASH_MULTIPLIER;
+        hashCode ^= hashCode >> KEY_HASH_SHIFT;
+        bytes += sizeof(word);
+        keySize -= sizeof(word);
+    }
+    // The last bytes are padded with zeros to a whole word.
+    word = 0;
+    memcpy(&word, bytes, keySize);
+    hashCode = (hashCode ^ word) * KEY_HASH_MULTIPLIER;
+    return hashCode ^ (hashCode >> KEY_HASH_SHIFT);
+}
+
+/**
+ * @brief Search the set of interned keys for a key which is equal to the given one.
+ *        The size of the keys and their Hash Codes are compared before their bytes.
+ * @param arena A pointer to the Key Arena.
+ * @param key The key to search.
+ * @param keySize The size of the key in bytes.
+ * @param hashCode The Hash Code of the key.
+ * @return The index of the slot of the key if found, otherwise the index of the empty slot
+ *         in which it would be interned.
+ */
+static size_t findInternSlot(const KeyArenaP arena, const void *key, size_t keySize,
+                             uint64_t hashCode)
+{
+    assert(arena != NULL && (arena -> internSlots) != NULL);
+
+    // The number of slots is a power of 2, so the index wraps around with a mask.
+    size_t mask = (arena -> numberOfInternSlots) - 1;
+    size_t index = (size_t)hashCode & mask;
+    while ((arena -> internSlots)[index].key != NULL)
+    {
+        const InternSlot *pSlot = &((arena -> internSlots)[index]);
+        if ((pSlot -> hashCode) == hashCode && arenaKeySize(pSlot -> key) == keySize
+            && memcmp(pSlot -> key, key, keySize) == 0)
+        {
+            break;
+        }
+        index = (index + 1) & mask;
+    }
+    return index;
+}
+
+/**
+ * @brief Grow the set of interned keys by the Intern Growth Factor, or allocate it's first slots.
+ *        If run out of memory, the set is left as it was.
+ * @param arena A pointer to the Key Arena.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool growInternSlots(KeyArenaP arena)
+{
+    assert(arena != NULL);
+
+    size_t oldSize = arena -> numberOfInternSlots;
+    size_t newSize = (oldSize == 0) ? INITIAL_INTERN_SLOTS : oldSize * INTERN_GROWTH_FACTOR;
+    InternSlot *newSlots = (InternSlot *)calloc(newSize, sizeof(InternSlot));
+    if (newSlots == NULL)
+    {
+        return false;
+    }
+
+    InternSlot *oldSlots = arena -> internSlots;
+    arena -> internSlots = newSlots;
+    arena -> numberOfInternSlots = newSize;
+    for (size_t i = 0; i < oldSize; i++)
+    {
+        if (oldSlots[i].key != NULL)
+        {
+            size_t index = findInternSlot(arena, oldSlots[i].key, arenaKeySize(oldSlots[i].key),
+                                          oldSlots[i].hashCode);
+            newSlots[index] = oldSlots[i];
+        }
+    }
+    free(oldSlots);
+    return true;
+}
+
+/**
+ * @brief Add a new Chunk to the Key Arena, which can hold at least the given number of bytes,
+ *        and make it the one to copy the next keys into.
+ * @param arena A pointer to the Key Arena.
+ * @param size The number of bytes the Chunk must hold.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool addChunk(KeyArenaP arena, size_t size)
+{
+    assert(arena != NULL);
+
+    size_t chunkSize = (size > (arena -> chunkSize)) ? size : (arena -> chunkSize);
+    ChunkP pChunk = (ChunkP)malloc(sizeof(Chunk) + chunkSize);
+    if (pChunk == NULL)
+    {
+        return false;
+    }
+
+    pChunk -> next = arena -> chunks;
+    arena -> chunks = pChunk;
+    arena -> nextByte = (unsigned char *)(pChunk -> bytes);
+    arena -> chunkEnd = (arena -> nextByte) + chunkSize;
+    (arena -> usedBytes) += chunkSize;
+
+    if ((arena -> chunkSize) < MAX_CHUNK_SIZE)
+    {
+        (arena -> chunkSize) *= CHUNK_GROWTH_FACTOR;
+    }
+    return true;
+}
+
+/**
+ * @brief Allocate memory for an empty Key Arena.
+ *        If internKeys is true, a key which is equal to a key already in the arena is not
+ *        copied again, and the copy in the arena is returned for it.
+ *        If run out of memory, return NULL.
+ * @param internKeys Whether the keys are interned.
+ * @return A pointer for the new Key Arena, or NULL if the process failed.
+ */
+KeyArenaP createKeyArena(bool internKeys)
+{
+    KeyArenaP arena = (KeyArenaP)malloc(sizeof(KeyArena));
+    if (arena == NULL)
+    {
+        return NULL;
+    }
+
+    arena -> chunks = NULL;
+    arena -> nextByte = NULL;
+    arena -> chunkEnd = NULL;
+    arena -> chunkSize = INITIAL_CHUNK_SIZE;
+    arena -> usedBytes = 0;
+    arena -> internKeys = internKeys;
+    arena -> internSlots = NULL;
+    arena -> numberOfInternSlots = 0;
+    arena -> numberOfInternedKeys = 0;
+    return arena;
+}
+
+/**
+ * @brief Copy the given key into the Key Arena, preceded by it's size. The copy is aligned
+ *        like memory from malloc, so any key can be read in place.
+ *        An interned key which is already in the Key Arena is not copied again. If the set of
+ *        interned keys can not grow, the key is copied without being interned.
+ * @param arena A pointer to the Key Arena.
+ * @param key The key to copy.
+ * @param keySize The size of the key in bytes.
+ * @return A pointer to the copy of the key, or NULL if out of memory.
+ */
+void * arenaStoreKey(KeyArenaP arena, const void *key, size_t keySize)
+{
+    assert(arena != NULL && key != NULL);
+
+    uint64_t hashCode = 0;
+    if (arena -> internKeys)
+    {
+        hashCode = hashKeyBytes(key, keySize);
+        if ((arena -> internSlots) != NULL)
+        {
+            size_t index = findInternSlot(arena, key, keySize, hashCode);
+            if ((arena -> internSlots)[index].key != NULL)
+            {
+                return (arena -> internSlots)[index].key;
+            }
+        }
+    }
+
+    size_t entrySize = sizeof(KeyHeader) + alignSize(keySize);
+    if ((size_t)((arena -> chunkEnd) - (arena -> nextByte)) < entrySize && !addChunk(arena, entrySize))
+    {
+        return NULL;
+    }
+
+    KeyHeader *pHeader = (KeyHeader *)(arena -> nextByte);
+    pHeader -> keySize = keySize;
+    unsigned char *storedKey = (arena -> nextByte) + sizeof(KeyHeader);
+    memcpy(storedKey, key, keySize);
+    (arena -> nextByte) += entrySize;
+
+    if ((arena -> internKeys)
+        && (((arena -> numberOfInternedKeys) + 1) * INTERN_GROWTH_FACTOR <= (arena -> numberOfInternSlots)
+            || growInternSlots(arena)))
+    {
+        size_t index = findInternSlot(arena, storedKey, keySize, hashCode);
+        (arena -> internSlots)[index].hashCode = hashCode;
+        (arena -> internSlots)[index].key = storedKey;
+        (arena -> numberOfInternedKeys)++;
+    }
+    return storedKey;
+}
+
+/**
+ * @brief Returns the size of a key which was copied into a Key Arena.
+ * @param storedKey A pointer to the copy of the key, as returned by arenaStoreKey.
+ * @return The size of the key in bytes.
+ */
+size_t arenaKeySize(const void *storedKey)
+{
+    return getKeyHeader(storedKey) -> keySize;
+}
+
+/**
+ * @brief Returns the number of bytes the Key Arena holds in it's chunks.
+ * @param arena A pointer to the Key Arena.
+ * @return The number of bytes.
+ */
+size_t arenaUsedBytes(const KeyArenaP arena)
+{
+    assert(arena != NULL);
+
+    return arena -> usedBytes;
+}
+
+/**
+ * @brief Free all the memory allocated for the Key Arena, including every key that was
+ *        copied into it. The cost depends on the number of chunks, not of keys.
+ *        If the given arena is NULL, no operation is performed.
+ * @param arena A pointer to the Key Arena to free.
+ */
+void freeKeyArena(KeyArenaP arena)
+{
+    if (arena != NULL)
+    {
+        ChunkP currentChunk = arena -> chunks;
+        while (currentChunk != NULL)
+        {
+            ChunkP nextChunk = currentChunk -> next;
+            free(currentChunk);
+            currentChunk = nextChunk;
+        }
+        free(arena -> internSlots);
+        free(arena);
+    }
+}
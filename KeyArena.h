@@ -0,0 +1,87 @@
+#ifndef _KEY_ARENA_H_
+#define _KEY_ARENA_H_
+
+/**
+ * @file KeyArena.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header file for the Key Arena. It declares an arena which copies keys of any size
+ *        one after the other into large chunks, and may intern them, so equal keys share a copy.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header file for the Key Arena. It declares an arena which copies keys of any size
+ * one after the other into large chunks, and may intern them, so equal keys share a copy.
+ * Input:       No particular input.
+ * Process:     A key is never released by itself, all the keys of the arena are released
+ *              at once with it's chunks. An arena may be shared by several Hash Tables.
+ * Output:      No particular output.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stddef.h>
+#include <stdbool.h>
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * KeyArenaP is a pointer for a Key Arena.
+ */
+typedef struct KeyArena *KeyArenaP;
+
+
+/*-----=  Forward Declarations  =-----*/
+
+
+/**
+ * @brief Allocate memory for an empty Key Arena.
+ *        If internKeys is true, a key which is equal to a key already in the arena is not
+ *        copied again, and the copy in the arena is returned for it.
+ *        If run out of memory, return NULL.
+ * @param internKeys Whether the keys are interned.
+ * @return A pointer for the new Key Arena, or NULL if the process failed.
+ */
+KeyArenaP createKeyArena(bool internKeys);
+
+/**
+ * @brief Copy the given key into the Key Arena, preceded by it's size. The copy is aligned
+ *        like memory from malloc, so any key can be read in place.
+ * @param arena A pointer to the Key Arena.
+ * @param key The key to copy.
+ * @param keySize The size of the key in bytes.
+ * @return A pointer to the copy of the key, or NULL if out of memory.
+ */
+void * arenaStoreKey(KeyArenaP arena, const void *key, size_t keySize);
+
+/**
+ * @brief Returns the size of a key which was copied into a Key Arena.
+ * @param storedKey A pointer to the copy of the key, as returned by arenaStoreKey.
+ * @return The size of the key in bytes.
+ */
+size_t arenaKeySize(const void *storedKey);
+
+/**
+ * @brief Returns the number of bytes the Key Arena holds in it's chunks.
+ * @param arena A pointer to the Key Arena.
+ * @return The number of bytes.
+ */
+size_t arenaUsedBytes(const KeyArenaP arena);
+
+/**
+ * @brief Free all the memory allocated for the Key Arena, including every key that was
+ *        copied into it. The cost depends on the number of chunks, not of keys.
+ *        If the given arena is NULL, no operation is performed.
+ * @param arena A pointer to the Key Arena to free.
+ */
+void freeKeyArena(KeyArenaP arena);
+
+#endif // _KEY_ARENA_H_
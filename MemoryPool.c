@@ -0,0 +1,303 @@
+/**
+ * @file MemoryPool.c
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A file for the Memory Pool. It defines a pool of fixed size blocks, which are
+ *        carved out of large slabs and recycled through a free list.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A file for the Memory Pool. It defines a pool of fixed size blocks, which are
+ * carved out of large slabs and recycled through a free list.
+ * Input:       No particular input.
+ * Process:     Each slab is twice as large as the previous one (up to a limit), so a pool
+ *              of millions of blocks needs only a few allocations.
+ * Output:      No particular output.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "MemoryPool.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def INITIAL_SLAB_BLOCKS 32
+ * @brief A Macro that sets the number of blocks in the first slab of a Memory Pool.
+ */
+#define INITIAL_SLAB_BLOCKS 32
+
+/**
+ * @def MAX_SLAB_BLOCKS 65536
+ * @brief A Macro that sets the max number of blocks in a single slab of a Memory Pool.
+ */
+#define MAX_SLAB_BLOCKS 65536
+
+/**
+ * @def SLAB_GROWTH_FACTOR 2
+ * @brief A Macro that sets the factor in which each slab is larger than the previous one.
+ */
+#define SLAB_GROWTH_FACTOR 2
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * SlabP is a pointer for a Slab of the Memory Pool.
+ */
+typedef struct Slab *SlabP;
+
+/**
+ * FreeBlockP is a pointer for a free block of the Memory Pool.
+ */
+typedef struct FreeBlock *FreeBlockP;
+
+
+/*-----=  Structs  =-----*/
+
+
+/**
+ * @brief A union of the types with the strictest alignment, every block is aligned to it.
+ */
+typedef union BlockAlignment
+{
+    void *pointer;
+    long long integer;
+    long double floating;
+} BlockAlignment;
+
+/**
+ * @brief A Structure representing the header of a Slab, the blocks follow it in memory.
+ *        The Slabs of a Memory Pool are linked, so they can all be released at once.
+ */
+typedef struct Slab
+{
+    SlabP next;
+    BlockAlignment blocks[];
+} Slab;
+
+/**
+ * @brief A Structure representing a free block, which holds the next free block.
+ */
+typedef struct FreeBlock
+{
+    FreeBlockP next;
+} FreeBlock;
+
+/**
+ * @brief A Structure representing the Memory Pool.
+ *        The Memory Pool holds the list of it's Slabs, the list of released blocks and
+ *        the unused part of the last Slab, which is handed out block by block.
+ */
+typedef struct MemoryPool
+{
+    size_t blockSize;
+    size_t slabBlocks;
+    SlabP slabs;
+    FreeBlockP freeBlocks;
+    char *nextBlock;
+    char *slabEnd;
+
+    // User Arena.
+    ArenaAllocFcn arenaAlloc;
+    ArenaFreeFcn arenaFree;
+    void *arena;
+} MemoryPool;
+
+
+/*-----=  Memory Pool Functions  =-----*/
+
+
+/**
+ * @brief Allocate memory of the given size for a Slab, with the user arena if there is one.
+ * @param pool A pointer to the Memory Pool.
+ * @param size The size in bytes.
+ * @return A pointer to the memory, or NULL if out of memory.
+ */
+static void * allocateSlabMemory(MemoryPoolP pool, size_t size)
+{
+    assert(pool != NULL);
+
+    if ((pool -> arenaAlloc) != NULL)
+    {
+        return (pool -> arenaAlloc)(pool -> arena, size);
+    }
+    return malloc(size);
+}
+
+/**
+ * @brief Release the memory of a Slab, with the user arena if there is one.
+ * @param pool A pointer to the Memory Pool.
+ * @param pSlab A pointer to the Slab to release.
+ */
+static void releaseSlabMemory(MemoryPoolP pool, SlabP pSlab)
+{
+    assert(pool != NULL);
+
+    if ((pool -> arenaAlloc) == NULL)
+    {
+        free(pSlab);
+    }
+    else if ((pool -> arenaFree) != NULL)
+    {
+        (pool -> arenaFree)(pool -> arena, pSlab);
+    }
+}
+
+/**
+ * @brief Add a new Slab to the Memory Pool, and make it's blocks the ones to hand out next.
+ * @param pool A pointer to the Memory Pool.
+ * @return true if the process succeed, false if out of memory.
+ */
+static bool addSlab(MemoryPoolP pool)
+{
+    assert(pool != NULL);
+
+    SlabP pSlab = allocateSlabMemory(pool, sizeof(Slab) + (pool -> slabBlocks) * (pool -> blockSize));
+    if (pSlab == NULL)
+    {
+        return false;
+    }
+
+    pSlab -> next = pool -> slabs;
+    pool -> slabs = pSlab;
+    pool -> nextBlock = (char *)(pSlab -> blocks);
+    pool -> slabEnd = (pool -> nextBlock) + (pool -> slabBlocks) * (pool -> blockSize);
+
+    if ((pool -> slabBlocks) < MAX_SLAB_BLOCKS)
+    {
+        (pool -> slabBlocks) *= SLAB_GROWTH_FACTOR;
+    }
+    return true;
+}
+
+/**
+ * @brief Allocate memory for a Memory Pool of blocks with the given size.
+ *        The slabs are allocated by arenaAlloc from arena and released by arenaFree, or with
+ *        malloc and free if arenaAlloc is NULL. arenaFree may be NULL if the arena releases it's
+ *        memory by itself.
+ *        If run out of memory, return NULL.
+ * @param blockSize The size of each block in bytes.
+ * @param arenaAlloc A pointer for the Arena Alloc function, or NULL.
+ * @param arenaFree A pointer for the Arena Free function, or NULL.
+ * @param arena The user arena which is given to the arena functions.
+ * @return A pointer for the new Memory Pool, or NULL if the process failed.
+ */
+MemoryPoolP createMemoryPool(size_t blockSize, ArenaAllocFcn arenaAlloc, ArenaFreeFcn arenaFree,
+                             void *arena)
+{
+    MemoryPoolP pool = (MemoryPoolP)malloc(sizeof(MemoryPool));
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+
+    // Every block must be able to hold a free block, and keep the next block aligned.
+    if (blockSize < sizeof(FreeBlock))
+    {
+        blockSize = sizeof(FreeBlock);
+    }
+    size_t alignment = sizeof(BlockAlignment);
+    pool -> blockSize = ((blockSize + alignment - 1) / alignment) * alignment;
+
+    pool -> slabBlocks = INITIAL_SLAB_BLOCKS;
+    pool -> slabs = NULL;
+    pool -> freeBlocks = NULL;
+    pool -> nextBlock = NULL;
+    pool -> slabEnd = NULL;
+    pool -> arenaAlloc = arenaAlloc;
+    pool -> arenaFree = arenaFree;
+    pool -> arena = arena;
+    return pool;
+}
+
+/**
+ * @brief Allocate memory for an empty Memory Pool with the same block size and user arena as
+ *        the given Memory Pool.
+ *        If run out of memory, return NULL.
+ * @param pool A pointer to the Memory Pool to match.
+ * @return A pointer for the new Memory Pool, or NULL if the process failed.
+ */
+MemoryPoolP createMatchingMemoryPool(const MemoryPoolP pool)
+{
+    assert(pool != NULL);
+
+    return createMemoryPool(pool -> blockSize, pool -> arenaAlloc, pool -> arenaFree, pool -> arena);
+}
+
+/**
+ * @brief Allocate a single block from the given Memory Pool.
+ * @param pool A pointer to the Memory Pool.
+ * @return A pointer to the block, or NULL if out of memory.
+ */
+void * poolAllocate(MemoryPoolP pool)
+{
+    assert(pool != NULL);
+
+    // Released blocks are reused first.
+    if ((pool -> freeBlocks) != NULL)
+    {
+        FreeBlockP pBlock = pool -> freeBlocks;
+        pool -> freeBlocks = pBlock -> next;
+        return pBlock;
+    }
+
+    if ((pool -> nextBlock) == (pool -> slabEnd) && !addSlab(pool))
+    {
+        return NULL;
+    }
+
+    void *pBlock = pool -> nextBlock;
+    (pool -> nextBlock) += pool -> blockSize;
+    return pBlock;
+}
+
+/**
+ * @brief Return a block to the given Memory Pool, so it would be reused by the next allocation.
+ *        If the given block is NULL, no operation is performed.
+ * @param pool A pointer to the Memory Pool.
+ * @param block The block to return, which was allocated from this Memory Pool.
+ */
+void poolRelease(MemoryPoolP pool, void *block)
+{
+    assert(pool != NULL);
+
+    if (block != NULL)
+    {
+        FreeBlockP pBlock = (FreeBlockP)block;
+        pBlock -> next = pool -> freeBlocks;
+        pool -> freeBlocks = pBlock;
+    }
+}
+
+/**
+ * @brief Free all the memory allocated for the Memory Pool, including every block that
+ *        was allocated from it.
+ * @param pool A pointer to the Memory Pool to free.
+ */
+void freeMemoryPool(MemoryPoolP pool)
+{
+    if (pool != NULL)
+    {
+        SlabP currentSlab = pool -> slabs;
+        while (currentSlab != NULL)
+        {
+            SlabP nextSlab = currentSlab -> next;
+            releaseSlabMemory(pool, currentSlab);
+            currentSlab = nextSlab;
+        }
+        free(pool);
+    }
+}
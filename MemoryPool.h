@@ -0,0 +1,105 @@
+#ifndef _MEMORY_POOL_H_
+#define _MEMORY_POOL_H_
+
+/**
+ * @file MemoryPool.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header file for the Memory Pool. It declares a pool of fixed size blocks, which are
+ *        carved out of large slabs and recycled through a free list.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header file for the Memory Pool. It declares a pool of fixed size blocks, which are
+ * carved out of large slabs and recycled through a free list.
+ * Input:       No particular input.
+ * Process:     The slabs are allocated with malloc, or with the functions of a user arena.
+ *              Releasing the pool releases all of it's slabs at once.
+ * Output:      No particular output.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stddef.h>
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * MemoryPoolP is a pointer for a Memory Pool.
+ */
+typedef struct MemoryPool *MemoryPoolP;
+
+/**
+ * @brief Allocate a block of the given size from the given user arena.
+ * @param arena The user arena.
+ * @param size The size of the block in bytes.
+ * @return A pointer to the block, or NULL if the arena is out of memory.
+ */
+typedef void * (*ArenaAllocFcn)(void *arena, size_t size);
+
+/**
+ * @brief Release a block that was allocated from the given user arena.
+ * @param arena The user arena.
+ * @param block The block to release.
+ */
+typedef void (*ArenaFreeFcn)(void *arena, void *block);
+
+
+/*-----=  Forward Declarations  =-----*/
+
+
+/**
+ * @brief Allocate memory for a Memory Pool of blocks with the given size.
+ *        The slabs are allocated by arenaAlloc from arena and released by arenaFree, or with
+ *        malloc and free if arenaAlloc is NULL. arenaFree may be NULL if the arena releases it's
+ *        memory by itself.
+ *        If run out of memory, return NULL.
+ * @param blockSize The size of each block in bytes.
+ * @param arenaAlloc A pointer for the Arena Alloc function, or NULL.
+ * @param arenaFree A pointer for the Arena Free function, or NULL.
+ * @param arena The user arena which is given to the arena functions.
+ * @return A pointer for the new Memory Pool, or NULL if the process failed.
+ */
+MemoryPoolP createMemoryPool(size_t blockSize, ArenaAllocFcn arenaAlloc, ArenaFreeFcn arenaFree,
+                             void *arena);
+
+/**
+ * @brief Allocate memory for an empty Memory Pool with the same block size and user arena as
+ *        the given Memory Pool.
+ *        If run out of memory, return NULL.
+ * @param pool A pointer to the Memory Pool to match.
+ * @return A pointer for the new Memory Pool, or NULL if the process failed.
+ */
+MemoryPoolP createMatchingMemoryPool(const MemoryPoolP pool);
+
+/**
+ * @brief Allocate a single block from the given Memory Pool.
+ * @param pool A pointer to the Memory Pool.
+ * @return A pointer to the block, or NULL if out of memory.
+ */
+void * poolAllocate(MemoryPoolP pool);
+
+/**
+ * @brief Return a block to the given Memory Pool, so it would be reused by the next allocation.
+ *        If the given block is NULL, no operation is performed.
+ * @param pool A pointer to the Memory Pool.
+ * @param block The block to return, which was allocated from this Memory Pool.
+ */
+void poolRelease(MemoryPoolP pool, void *block);
+
+/**
+ * @brief Free all the memory allocated for the Memory Pool, including every block that
+ *        was allocated from it.
+ * @param pool A pointer to the Memory Pool to free.
+ */
+void freeMemoryPool(MemoryPoolP pool);
+
+#endif // _MEMORY_POOL_H_
@@ -25,6 +25,8 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
 #include <assert.h>
 #include "MyIntFunctions.h"
 
@@ -37,6 +39,31 @@
  */
 #define PRINT_FORMAT "%d"
 
+/**
+ * @def MIX_SHIFT 33
+ * @brief A Macro that sets the shift which folds the high bits of a mixed key into it's low bits.
+ */
+#define MIX_SHIFT 33
+
+/**
+ * @def MIX_MULTIPLIER_1 0xFF51AFD7ED558CCD
+ * @brief A Macro that sets the first multiplier of the key mixing.
+ */
+#define MIX_MULTIPLIER_1 UINT64_C(0xFF51AFD7ED558CCD)
+
+/**
+ * @def MIX_MULTIPLIER_2 0xC4CEB9FE1A85EC53
+ * @brief A Macro that sets the second multiplier of the key mixing.
+ */
+#define MIX_MULTIPLIER_2 UINT64_C(0xC4CEB9FE1A85EC53)
+
+/**
+ * @def MIX_HALF_BITS 32
+ * @brief A Macro that sets half of the bits of a mixed key, it's high half is scaled to the
+ *        Table size.
+ */
+#define MIX_HALF_BITS 32
+
 
 /*-----=  My Int Functions  =-----*/
 
@@ -103,6 +130,62 @@ int intFcn(const void *key, size_t tableSize)
     return hashCode;
 }
 
+/**
+ * @brief Mixes the bits of the given key by a 64 bit finalizer.
+ * @param key The key to mix.
+ * @return The mixed key.
+ */
+static inline uint64_t mixIntKey(int key)
+{
+    uint64_t mixedKey = (uint32_t)key;
+    mixedKey ^= mixedKey >> MIX_SHIFT;
+    mixedKey *= MIX_MULTIPLIER_1;
+    mixedKey ^= mixedKey >> MIX_SHIFT;
+    mixedKey *= MIX_MULTIPLIER_2;
+    mixedKey ^= mixedKey >> MIX_SHIFT;
+    return mixedKey;
+}
+
+/**
+ * @brief Generates the Hash Code of the given key for HashTable with size tableSize.
+ *        The bits of the key are mixed by a 64 bit finalizer, so keys that differ only in a few
+ *        bits, such as strided ids, get unrelated Hash Codes, which are scaled to the Table size.
+ *        A Table of more than INT_MAX cells gets only Hash Codes of it's first INT_MAX cells, so
+ *        it should be hashed by intMixFcn64.
+ * @param key The key to generate Hash Code to.
+ * @param tableSize The size of the Hash Table.
+ * @return A Number between 0 - (tableSize-1) or negative number in case of an error.
+ */
+int intMixFcn(const void *key, size_t tableSize)
+{
+    int hashCode = INVALID_HASH_CODE;
+
+    if (key != NULL && tableSize > 0)
+    {
+        uint64_t mixedKey = mixIntKey(*(int *)key);
+
+        // Scaling the high half to the Table size is a multiplication instead of a division.
+        // An int holds the cells up to INT_MAX only, so a larger Table is scaled as if it had
+        // INT_MAX cells.
+        size_t cells = (tableSize < INT_MAX) ? tableSize : INT_MAX;
+        hashCode = (int)(((mixedKey >> MIX_HALF_BITS) * cells) >> MIX_HALF_BITS);
+    }
+
+    return hashCode;
+}
+
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key, mixed as in intMixFcn.
+ * @param key The key to generate Hash Code to.
+ * @return The Hash Code of the key.
+ */
+uint64_t intMixFcn64(const void *key)
+{
+    assert(key != NULL);
+
+    return mixIntKey(*(int *)key);
+}
+
 /**
  * @brief Prints the given key to the standard output.
  * @param key The key to print.
@@ -56,6 +56,25 @@ void freeInt(void *i);
  */
 int intFcn(const void *key, size_t tableSize);
 
+/**
+ * @brief Generates the Hash Code of the given key for HashTable with size tableSize.
+ *        The bits of the key are mixed by a 64 bit finalizer, so keys that differ only in a few
+ *        bits, such as strided ids, get unrelated Hash Codes, which are scaled to the Table size.
+ *        A Table of more than INT_MAX cells gets only Hash Codes of it's first INT_MAX cells, so
+ *        it should be hashed by intMixFcn64.
+ * @param key The key to generate Hash Code to.
+ * @param tableSize The size of the Hash Table.
+ * @return A Number between 0 - (tableSize-1) or negative number in case of an error.
+ */
+int intMixFcn(const void *key, size_t tableSize);
+
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key, mixed as in intMixFcn.
+ * @param key The key to generate Hash Code to.
+ * @return The Hash Code of the key.
+ */
+uint64_t intMixFcn64(const void *key);
+
 /**
  * @brief Prints the given key to the standard output.
  * @param key The key to print.
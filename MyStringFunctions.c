@@ -25,6 +25,8 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
 #include <string.h>
 #include <assert.h>
 #include "MyStringFunctions.h"
@@ -39,6 +41,12 @@
  */
 #define PRINT_FORMAT "%s"
 
+/**
+ * @def LEN_STR_PRINT_FORMAT "%.*s"
+ * @brief A Macro that sets the output format of printing the chars of a length-prefixed key.
+ */
+#define LEN_STR_PRINT_FORMAT "%.*s"
+
 /**
  * @def STRING_TERMINATOR_COUNT 1
  * @brief A Macro that sets the number for the string terminator addition.
@@ -57,6 +65,156 @@
  */
 #define STRING_TERMINATOR '\0'
 
+/**
+ * @def MIX_PRIME_1 0x9E3779B185EBCA87
+ * @brief A Macro that sets the first prime of the string mixing.
+ */
+#define MIX_PRIME_1 UINT64_C(0x9E3779B185EBCA87)
+
+/**
+ * @def MIX_PRIME_2 0xC2B2AE3D27D4EB4F
+ * @brief A Macro that sets the second prime of the string mixing.
+ */
+#define MIX_PRIME_2 UINT64_C(0xC2B2AE3D27D4EB4F)
+
+/**
+ * @def MIX_PRIME_3 0x165667B19E3779F9
+ * @brief A Macro that sets the third prime of the string mixing.
+ */
+#define MIX_PRIME_3 UINT64_C(0x165667B19E3779F9)
+
+/**
+ * @def MIX_PRIME_4 0x85EBCA77C2B2AE63
+ * @brief A Macro that sets the fourth prime of the string mixing.
+ */
+#define MIX_PRIME_4 UINT64_C(0x85EBCA77C2B2AE63)
+
+/**
+ * @def WORD_ROTATION 31
+ * @brief A Macro that sets the rotation of a word of the string during it's mixing.
+ */
+#define WORD_ROTATION 31
+
+/**
+ * @def HASH_ROTATION 27
+ * @brief A Macro that sets the rotation of the Hash after a word is mixed into it.
+ */
+#define HASH_ROTATION 27
+
+/**
+ * @def WORD_BITS 64
+ * @brief A Macro that sets the number of bits in a word of the string.
+ */
+#define WORD_BITS 64
+
+/**
+ * @def HALF_WORD_BITS 32
+ * @brief A Macro that sets half of the bits of a word, the high half of the Hash is scaled to
+ *        the Table size.
+ */
+#define HALF_WORD_BITS 32
+
+/**
+ * @def AVALANCHE_SHIFT_1 33
+ * @brief A Macro that sets the first shift of the final avalanche of the Hash.
+ */
+#define AVALANCHE_SHIFT_1 33
+
+/**
+ * @def AVALANCHE_SHIFT_2 29
+ * @brief A Macro that sets the second shift of the final avalanche of the Hash.
+ */
+#define AVALANCHE_SHIFT_2 29
+
+/**
+ * @def SIP_INIT_0 0x736F6D6570736575
+ * @brief A Macro that sets the constant which initializes the first word of the SipHash state.
+ */
+#define SIP_INIT_0 UINT64_C(0x736F6D6570736575)
+
+/**
+ * @def SIP_INIT_1 0x646F72616E646F6D
+ * @brief A Macro that sets the constant which initializes the second word of the SipHash state.
+ */
+#define SIP_INIT_1 UINT64_C(0x646F72616E646F6D)
+
+/**
+ * @def SIP_INIT_2 0x6C7967656E657261
+ * @brief A Macro that sets the constant which initializes the third word of the SipHash state.
+ */
+#define SIP_INIT_2 UINT64_C(0x6C7967656E657261)
+
+/**
+ * @def SIP_INIT_3 0x7465646279746573
+ * @brief A Macro that sets the constant which initializes the fourth word of the SipHash state.
+ */
+#define SIP_INIT_3 UINT64_C(0x7465646279746573)
+
+/**
+ * @def SIP_FINAL_FLAG 0xFF
+ * @brief A Macro that sets the value mixed into the SipHash state before the final rounds.
+ */
+#define SIP_FINAL_FLAG UINT64_C(0xFF)
+
+/**
+ * @def SIP_COMPRESSION_ROUNDS 2
+ * @brief A Macro that sets the number of SipHash rounds for each word of the string.
+ */
+#define SIP_COMPRESSION_ROUNDS 2
+
+/**
+ * @def SIP_FINALIZATION_ROUNDS 4
+ * @brief A Macro that sets the number of SipHash rounds after the last word.
+ */
+#define SIP_FINALIZATION_ROUNDS 4
+
+/**
+ * @def SIP_ROTATE_V1_FIRST 13
+ * @brief A Macro that sets the rotation of the second word of the SipHash state in the first
+ *        half of a round.
+ */
+#define SIP_ROTATE_V1_FIRST 13
+
+/**
+ * @def SIP_ROTATE_V3_FIRST 16
+ * @brief A Macro that sets the rotation of the fourth word of the SipHash state in the first
+ *        half of a round.
+ */
+#define SIP_ROTATE_V3_FIRST 16
+
+/**
+ * @def SIP_ROTATE_V3_SECOND 21
+ * @brief A Macro that sets the rotation of the fourth word of the SipHash state in the second
+ *        half of a round.
+ */
+#define SIP_ROTATE_V3_SECOND 21
+
+/**
+ * @def SIP_ROTATE_V1_SECOND 17
+ * @brief A Macro that sets the rotation of the second word of the SipHash state in the second
+ *        half of a round.
+ */
+#define SIP_ROTATE_V1_SECOND 17
+
+/**
+ * @def SIP_ROTATE_HALF 32
+ * @brief A Macro that sets the rotation which swaps the halves of the first and the third words
+ *        of the SipHash state.
+ */
+#define SIP_ROTATE_HALF 32
+
+/**
+ * @def LENGTH_BYTE_SHIFT 56
+ * @brief A Macro that sets the shift of the length byte in the last word of the SipHash input.
+ */
+#define LENGTH_BYTE_SHIFT 56
+
+/**
+ * @def BYTE_BITS 8
+ * @brief A Macro that sets the number of bits in a byte.
+ */
+#define BYTE_BITS 8
+
 
 /*-----=  My String Functions  =-----*/
 
@@ -72,11 +230,13 @@ void * cloneStr(const void *s)
 {
     assert(s != NULL);
 
+    // The length is measured once, and the string is copied with it's terminator.
+    size_t cloneSize = sizeof(char) * (strlen((char *)s) + STRING_TERMINATOR_COUNT);
     char *clone = NULL;
-    clone = (char *)malloc(sizeof(char) * (strlen((char *)s) + STRING_TERMINATOR_COUNT));
+    clone = (char *)malloc(cloneSize);
     if (clone != NULL)
     {
-        strcpy(clone, s);
+        memcpy(clone, s, cloneSize);
     }
     else
     {
@@ -125,6 +285,202 @@ int strFcn(const void *s, size_t tableSize)
     return hashCode;
 }
 
+/**
+ * @brief Rotates the given word left by the given number of bits.
+ * @param word The word to rotate.
+ * @param bits The number of bits, between 1 - 63.
+ * @return The rotated word.
+ */
+static inline uint64_t rotateWord(uint64_t word, int bits)
+{
+    return (word << bits) | (word >> (WORD_BITS - bits));
+}
+
+/**
+ * @brief Mixes the given word of a string into the given Hash.
+ * @param hash The Hash of the previous words.
+ * @param word The next word.
+ * @return The Hash with the word mixed into it.
+ */
+static inline uint64_t mixWord(uint64_t hash, uint64_t word)
+{
+    word *= MIX_PRIME_2;
+    word = rotateWord(word, WORD_ROTATION);
+    word *= MIX_PRIME_1;
+    hash ^= word;
+    return rotateWord(hash, HASH_ROTATION) * MIX_PRIME_1 + MIX_PRIME_4;
+}
+
+/**
+ * @brief Mixes the given chars 8 bytes at a time and avalanches the result, so every char
+ *        affects every bit of the Hash.
+ * @param chars The chars to mix.
+ * @param length The number of chars.
+ * @return The Hash of the chars.
+ */
+static uint64_t mixString(const char *chars, size_t length)
+{
+    assert(chars != NULL);
+
+    const unsigned char *stringKey = (const unsigned char *)chars;
+    uint64_t hash = MIX_PRIME_3 + (uint64_t)length * MIX_PRIME_1;
+
+    uint64_t word = 0;
+    while (length >= sizeof(word))
+    {
+        memcpy(&word, stringKey, sizeof(word));
+        hash = mixWord(hash, word);
+        stringKey += sizeof(word);
+        length -= sizeof(word);
+    }
+    // The last chars are padded with zeros to a whole word.
+    word = 0;
+    memcpy(&word, stringKey, length);
+    hash = mixWord(hash, word);
+
+    hash ^= hash >> AVALANCHE_SHIFT_1;
+    hash *= MIX_PRIME_2;
+    hash ^= hash >> AVALANCHE_SHIFT_2;
+    hash *= MIX_PRIME_3;
+    hash ^= hash >> HALF_WORD_BITS;
+    return hash;
+}
+
+/**
+ * @brief Generates the Hash Code of the given key for HashTable with size tableSize.
+ *        The string is mixed 8 bytes at a time and the result is avalanched, so every char
+ *        affects every bit of the Hash Code, which is scaled to the Table size.
+ *        A Table of more than INT_MAX cells gets only Hash Codes of it's first INT_MAX cells, so
+ *        it should be hashed by strMixFcn64.
+ * @param s The key to generate Hash Code to.
+ * @param tableSize The size of the Hash Table.
+ * @return A Number between 0 - (tableSize-1) or negative number in case of an error.
+ */
+int strMixFcn(const void *s, size_t tableSize)
+{
+    int hashCode = INVALID_HASH_CODE;
+
+    if (s != NULL && tableSize > 0)
+    {
+        uint64_t hash = mixString((const char *)s, strlen((const char *)s));
+
+        // Scaling the high half to the Table size is a multiplication instead of a division.
+        // An int holds the cells up to INT_MAX only, so a larger Table is scaled as if it had
+        // INT_MAX cells.
+        size_t cells = (tableSize < INT_MAX) ? tableSize : INT_MAX;
+        hashCode = (int)(((hash >> HALF_WORD_BITS) * cells) >> HALF_WORD_BITS);
+    }
+
+    return hashCode;
+}
+
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key, mixed as in strMixFcn.
+ * @param s The key to generate Hash Code to.
+ * @return The Hash Code of the key.
+ */
+uint64_t strMixFcn64(const void *s)
+{
+    assert(s != NULL);
+
+    return mixString((const char *)s, strlen((const char *)s));
+}
+
+/**
+ * @brief Reads a little endian word from the given bytes, so a Hash does not depend on the
+ *        byte order of the machine.
+ * @param bytes The bytes to read, at least up to the given number.
+ * @param length The number of bytes to read, up to 8.
+ * @return The word, whose missing high bytes are zeros.
+ */
+static inline uint64_t readLittleEndianWord(const unsigned char *bytes, size_t length)
+{
+    uint64_t word = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        word |= (uint64_t)bytes[i] << (BYTE_BITS * i);
+    }
+    return word;
+}
+
+/**
+ * @brief Runs the given number of SipHash rounds on the given state.
+ * @param v The four words of the SipHash state.
+ * @param rounds The number of rounds.
+ */
+static inline void sipRounds(uint64_t v[4], int rounds)
+{
+    for (int i = 0; i < rounds; i++)
+    {
+        v[0] += v[1];
+        v[1] = rotateWord(v[1], SIP_ROTATE_V1_FIRST);
+        v[1] ^= v[0];
+        v[0] = rotateWord(v[0], SIP_ROTATE_HALF);
+        v[2] += v[3];
+        v[3] = rotateWord(v[3], SIP_ROTATE_V3_FIRST);
+        v[3] ^= v[2];
+        v[0] += v[3];
+        v[3] = rotateWord(v[3], SIP_ROTATE_V3_SECOND);
+        v[3] ^= v[0];
+        v[2] += v[1];
+        v[1] = rotateWord(v[1], SIP_ROTATE_V1_SECOND);
+        v[1] ^= v[2];
+        v[2] = rotateWord(v[2], SIP_ROTATE_HALF);
+    }
+}
+
+/**
+ * @brief Generates the SipHash-2-4 of the given chars under the given secret seed.
+ * @param chars The chars to hash.
+ * @param length The number of chars.
+ * @param seed The secret seed.
+ * @return The Hash of the chars.
+ */
+static uint64_t sipString(const char *chars, size_t length, const HashSeed *seed)
+{
+    assert(chars != NULL && seed != NULL);
+
+    const unsigned char *stringKey = (const unsigned char *)chars;
+    uint64_t lastWord = (uint64_t)length << LENGTH_BYTE_SHIFT;
+    uint64_t v[4] = {SIP_INIT_0 ^ (seed -> k0), SIP_INIT_1 ^ (seed -> k1),
+                     SIP_INIT_2 ^ (seed -> k0), SIP_INIT_3 ^ (seed -> k1)};
+
+    while (length >= sizeof(uint64_t))
+    {
+        uint64_t word = readLittleEndianWord(stringKey, sizeof(uint64_t));
+        v[3] ^= word;
+        sipRounds(v, SIP_COMPRESSION_ROUNDS);
+        v[0] ^= word;
+        stringKey += sizeof(uint64_t);
+        length -= sizeof(uint64_t);
+    }
+    // The last chars are padded with zeros, and the top byte holds the length of the string.
+    lastWord |= readLittleEndianWord(stringKey, length);
+    v[3] ^= lastWord;
+    sipRounds(v, SIP_COMPRESSION_ROUNDS);
+    v[0] ^= lastWord;
+
+    v[2] ^= SIP_FINAL_FLAG;
+    sipRounds(v, SIP_FINALIZATION_ROUNDS);
+    return v[0] ^ v[1] ^ v[2] ^ v[3];
+}
+
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key under the given secret seed.
+ *        The Hash is SipHash-2-4, so without the seed no one can craft strings that collide,
+ *        even if the attacker sees the Hash Codes of other strings.
+ * @param s The key to generate Hash Code to.
+ * @param seed The secret seed of the Hash Table.
+ * @return The Hash Code of the key.
+ */
+uint64_t strSipFcn(const void *s, const HashSeed *seed)
+{
+    assert(s != NULL);
+
+    return sipString((const char *)s, strlen((const char *)s), seed);
+}
+
+
 /**
  * @brief Prints the given key to the standard output.
  * @param s The key to print.
@@ -161,3 +517,160 @@ int strCompare(const void * key1, const void * key2)
 
     return COMPARE_ERROR_VALUE;
 }
+
+/**
+ * @brief Returns the number of bytes which hold the given key, including it's terminator.
+ * @param s The key to measure.
+ * @return The size of the key in bytes.
+ */
+size_t strKeySize(const void *s)
+{
+    assert(s != NULL);
+
+    return sizeof(char) * (strlen((char *)s) + STRING_TERMINATOR_COUNT);
+}
+
+/**
+ * @brief Returns a length-prefixed String Key of the given string, whose length is measured once.
+ *        The key points to the given string, which must outlive it.
+ * @param s The string.
+ * @return The length-prefixed String Key.
+ */
+LenStr makeLenStr(const char *s)
+{
+    assert(s != NULL);
+
+    LenStr key = {s, strlen(s)};
+    return key;
+}
+
+/**
+ * @brief Allocate memory for a duplication of the given length-prefixed String Key, which holds
+ *        it's chars in the same block, so the clone is a single allocation.
+ *        If run out of memory, report error MEM_OUT to the standard error and return NULL.
+ * @param key The LenStr key to clone.
+ * @return Return the clone key if succeed, NULL otherwise.
+ */
+void * cloneLenStr(const void *key)
+{
+    assert(key != NULL);
+
+    const LenStr *stringKey = (const LenStr *)key;
+    LenStr *clone = (LenStr *)malloc(sizeof(LenStr)
+                                     + sizeof(char) * ((stringKey -> length) + STRING_TERMINATOR_COUNT));
+    if (clone == NULL)
+    {
+        reportError(MEM_OUT);
+        return NULL;
+    }
+
+    char *chars = (char *)(clone + 1);
+    memcpy(chars, stringKey -> chars, stringKey -> length);
+    chars[stringKey -> length] = STRING_TERMINATOR;
+    clone -> chars = chars;
+    clone -> length = stringKey -> length;
+    return clone;
+}
+
+/**
+ * @brief Free all the memory allocated for the given length-prefixed String Key.
+ * @param key The LenStr key to free, which was cloned by cloneLenStr.
+ */
+void freeLenStr(void *key)
+{
+    free(key);
+}
+
+/**
+ * @brief Generates the Hash Code of the given key for HashTable with size tableSize.
+ *        The chars are mixed as in strMixFcn, without searching for their end, and a Table of
+ *        more than INT_MAX cells should be hashed by lenStrFcn64 as well.
+ * @param key The LenStr key to generate Hash Code to.
+ * @param tableSize The size of the Hash Table.
+ * @return A Number between 0 - (tableSize-1) or negative number in case of an error.
+ */
+int lenStrFcn(const void *key, size_t tableSize)
+{
+    int hashCode = INVALID_HASH_CODE;
+
+    if (key != NULL && tableSize > 0)
+    {
+        const LenStr *stringKey = (const LenStr *)key;
+        uint64_t hash = mixString(stringKey -> chars, stringKey -> length);
+
+        // Scaling the high half to the Table size is a multiplication instead of a division.
+        // An int holds the cells up to INT_MAX only, so a larger Table is scaled as if it had
+        // INT_MAX cells.
+        size_t cells = (tableSize < INT_MAX) ? tableSize : INT_MAX;
+        hashCode = (int)(((hash >> HALF_WORD_BITS) * cells) >> HALF_WORD_BITS);
+    }
+
+    return hashCode;
+}
+
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key, mixed as in strMixFcn.
+ * @param key The LenStr key to generate Hash Code to.
+ * @return The Hash Code of the key.
+ */
+uint64_t lenStrFcn64(const void *key)
+{
+    assert(key != NULL);
+
+    const LenStr *stringKey = (const LenStr *)key;
+    return mixString(stringKey -> chars, stringKey -> length);
+}
+
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key under the given secret seed,
+ *        as in strSipFcn.
+ * @param key The LenStr key to generate Hash Code to.
+ * @param seed The secret seed of the Hash Table.
+ * @return The Hash Code of the key.
+ */
+uint64_t lenStrSipFcn(const void *key, const HashSeed *seed)
+{
+    assert(key != NULL);
+
+    const LenStr *stringKey = (const LenStr *)key;
+    return sipString(stringKey -> chars, stringKey -> length, seed);
+}
+
+/**
+ * @brief Prints the given key to the standard output.
+ * @param key The LenStr key to print.
+ */
+void lenStrPrint(const void *key)
+{
+    if (key != NULL)
+    {
+        const LenStr *stringKey = (const LenStr *)key;
+        printf(LEN_STR_PRINT_FORMAT, (int)(stringKey -> length), stringKey -> chars);
+    }
+}
+
+/**
+ * @brief Compares 2 given length-prefixed String Keys. Their lengths are compared first, and
+ *        only keys of the same length compare their chars, with memcmp.
+ * @param key1 The first LenStr key to compare.
+ * @param key2 The second LenStr key to compare.
+ * @return 0 if both keys are equal, otherwise return a non-zero value.
+ */
+int lenStrCompare(const void * key1, const void * key2)
+{
+    if ((key1 != NULL) && (key2 != NULL))
+    {
+        const LenStr *stringKey1 = (const LenStr *)key1;
+        const LenStr *stringKey2 = (const LenStr *)key2;
+
+        if ((stringKey1 -> length) == (stringKey2 -> length)
+            && memcmp(stringKey1 -> chars, stringKey2 -> chars, stringKey1 -> length) == EQUALITY_VALUE)
+        {
+            return EQUALITY_VALUE;
+        }
+
+        return NON_EQUALITY_VALUE;
+    }
+
+    return COMPARE_ERROR_VALUE;
+}
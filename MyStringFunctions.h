@@ -29,6 +29,24 @@
 #include "Key.h"
 
 
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A length-prefixed String Key, i.e. a pointer to it's chars and their number, so the
+ *        string is measured once and the Hash and Comparison functions never search it's end.
+ *        The chars of a cloned key are followed by a terminator.
+ *        A LenStr key only points to it's chars, so a Hash Table must copy it by cloneLenStr,
+ *        which copies the chars as well, and must not store it inline or in a key arena,
+ *        whose shallow copy would point to chars which are freed with the original key.
+ */
+typedef struct LenStr
+{
+    const char *chars;
+    size_t length;
+} LenStr;
+
+
 /*-----=  Forward Declarations  =-----*/
 
 
@@ -56,6 +74,34 @@ void freeStr(void *s);
  */
 int strFcn(const void *s, size_t tableSize);
 
+/**
+ * @brief Generates the Hash Code of the given key for HashTable with size tableSize.
+ *        The string is mixed 8 bytes at a time and the result is avalanched, so every char
+ *        affects every bit of the Hash Code, which is scaled to the Table size.
+ *        A Table of more than INT_MAX cells gets only Hash Codes of it's first INT_MAX cells, so
+ *        it should be hashed by strMixFcn64.
+ * @param s The key to generate Hash Code to.
+ * @param tableSize The size of the Hash Table.
+ * @return A Number between 0 - (tableSize-1) or negative number in case of an error.
+ */
+int strMixFcn(const void *s, size_t tableSize);
+
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key, mixed as in strMixFcn.
+ * @param s The key to generate Hash Code to.
+ * @return The Hash Code of the key.
+ */
+uint64_t strMixFcn64(const void *s);
+
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key under the given secret seed.
+ *        The Hash is SipHash-2-4, so without the seed no one can craft strings that collide.
+ * @param s The key to generate Hash Code to.
+ * @param seed The secret seed of the Hash Table.
+ * @return The Hash Code of the key.
+ */
+uint64_t strSipFcn(const void *s, const HashSeed *seed);
+
 /**
  * @brief Prints the given key to the standard output.
  * @param s The key to print.
@@ -70,4 +116,75 @@ void strPrint(const void *s);
  */
 int strCompare(const void * key1, const void * key2);
 
+/**
+ * @brief Returns the number of bytes which hold the given key, including it's terminator.
+ * @param s The key to measure.
+ * @return The size of the key in bytes.
+ */
+size_t strKeySize(const void *s);
+
+/**
+ * @brief Returns a length-prefixed String Key of the given string, whose length is measured once.
+ *        The key points to the given string, which must outlive it.
+ * @param s The string.
+ * @return The length-prefixed String Key.
+ */
+LenStr makeLenStr(const char *s);
+
+/**
+ * @brief Allocate memory for a duplication of the given length-prefixed String Key, which holds
+ *        it's chars in the same block.
+ *        If run out of memory, report error MEM_OUT to the standard error and return NULL.
+ * @param key The LenStr key to clone.
+ * @return Return the clone key if succeed, NULL otherwise.
+ */
+void * cloneLenStr(const void *key);
+
+/**
+ * @brief Free all the memory allocated for the given length-prefixed String Key.
+ * @param key The LenStr key to free, which was cloned by cloneLenStr.
+ */
+void freeLenStr(void *key);
+
+/**
+ * @brief Generates the Hash Code of the given key for HashTable with size tableSize.
+ *        The chars are mixed as in strMixFcn, without searching for their end, and a Table of
+ *        more than INT_MAX cells should be hashed by lenStrFcn64 as well.
+ * @param key The LenStr key to generate Hash Code to.
+ * @param tableSize The size of the Hash Table.
+ * @return A Number between 0 - (tableSize-1) or negative number in case of an error.
+ */
+int lenStrFcn(const void *key, size_t tableSize);
+
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key, mixed as in strMixFcn.
+ * @param key The LenStr key to generate Hash Code to.
+ * @return The Hash Code of the key.
+ */
+uint64_t lenStrFcn64(const void *key);
+
+/**
+ * @brief Generates the full 64 bit Hash Code of the given key under the given secret seed,
+ *        as in strSipFcn.
+ * @param key The LenStr key to generate Hash Code to.
+ * @param seed The secret seed of the Hash Table.
+ * @return The Hash Code of the key.
+ */
+uint64_t lenStrSipFcn(const void *key, const HashSeed *seed);
+
+/**
+ * @brief Prints the given key to the standard output.
+ * @param key The LenStr key to print.
+ */
+void lenStrPrint(const void *key);
+
+/**
+ * @brief Compares 2 given length-prefixed String Keys. Their lengths are compared first, and
+ *        only keys of the same length compare their chars.
+ * @param key1 The first LenStr key to compare.
+ * @param key2 The second LenStr key to compare.
+ * @return 0 if both keys are equal, otherwise return a non-zero value.
+ */
+int lenStrCompare(const void * key1, const void * key2);
+
 #endif // _MY_STR_FUNCTIONS_H_
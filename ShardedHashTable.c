@@ -0,0 +1,493 @@
+/**
+ * @file ShardedHashTable.c
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A file for the Sharded Hash Table. It defines a thread-safe Hash Table which
+ *        partitions it's keys between several independent Generic Hash Tables, each guarded by
+ *        it's own reader-writer lock.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A file for the Sharded Hash Table. It defines a thread-safe Hash Table which
+ * partitions it's keys between several independent Generic Hash Tables, each guarded by
+ * it's own reader-writer lock.
+ * Input:       No particular input.
+ * Process:     Each operation hashes it's key once to find it's shard, and then runs the
+ *              operation of the Generic Hash Table on the shard under it's lock. The shards are
+ *              kept on separate cache lines, so threads that work on different shards do not
+ *              contend on their lock words.
+ * Output:      No particular output.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <assert.h>
+#include <pthread.h>
+#include "TableErrorHandle.h"
+#include "ShardedHashTable.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def INITIAL_INDEX 0
+ * @brief A Macro that sets the initial index for arrays and loops.
+ */
+#define INITIAL_INDEX 0
+
+/**
+ * @def MINIMAL_NUMBER_OF_SHARDS 1
+ * @brief A Macro that sets the minimal number of shards of a Sharded Hash Table.
+ */
+#define MINIMAL_NUMBER_OF_SHARDS 1
+
+/**
+ * @def LOCK_SUCCESS 0
+ * @brief A Macro that sets the value which the lock functions return on success.
+ */
+#define LOCK_SUCCESS 0
+
+/**
+ * @def CACHE_LINE_SIZE 64
+ * @brief A Macro that sets the size of a cache line, which separates the locks of the shards.
+ */
+#define CACHE_LINE_SIZE 64
+
+/**
+ * @def SHARD_MIX_SHIFT 33
+ * @brief A Macro that sets the shift of each xor-shift step of the finalizer which mixes the
+ *        Hash Code of a key before it chooses the shard of the key.
+ */
+#define SHARD_MIX_SHIFT 33
+
+/**
+ * @def SHARD_MIX_MULTIPLIER_1 0xFF51AFD7ED558CCD
+ * @brief A Macro that sets the first multiplier of the finalizer of a shard Hash Code.
+ */
+#define SHARD_MIX_MULTIPLIER_1 UINT64_C(0xFF51AFD7ED558CCD)
+
+/**
+ * @def SHARD_MIX_MULTIPLIER_2 0xC4CEB9FE1A85EC53
+ * @brief A Macro that sets the second multiplier of the finalizer of a shard Hash Code.
+ */
+#define SHARD_MIX_MULTIPLIER_2 UINT64_C(0xC4CEB9FE1A85EC53)
+
+/**
+ * @def SHARD_HASH_SHIFT 32
+ * @brief A Macro that sets the number of low bits of a mixed Hash Code, which are scaled to
+ *        the number of shards.
+ */
+#define SHARD_HASH_SHIFT 32
+
+/**
+ * @def SHARD_HASH_MASK 0xFFFFFFFF
+ * @brief A Macro that sets the mask of the low bits of a mixed Hash Code.
+ */
+#define SHARD_HASH_MASK UINT64_C(0xFFFFFFFF)
+
+/**
+ * @def FULL_HASH_RANGE INT_MAX
+ * @brief A Macro that sets the Table size given to a Hash function which chooses a shard.
+ */
+#define FULL_HASH_RANGE ((size_t)INT_MAX)
+
+/**
+ * @def SHARD_PRINT "Shard %zu:\n"
+ * @brief A Macro that sets the output format of printing the title of a shard.
+ */
+#define SHARD_PRINT "Shard %zu:\n"
+
+
+/*-----=  Structs  =-----*/
+
+
+/**
+ * @brief A Structure representing a single shard, which is a Generic Hash Table and the lock
+ *        that guards it. The shards are padded, so the locks of two shards never share a
+ *        cache line.
+ */
+typedef struct Shard
+{
+    pthread_rwlock_t lock;
+    TableP table;
+    char padding[CACHE_LINE_SIZE];
+} Shard;
+
+/**
+ * @brief A Structure representing the Sharded Hash Table.
+ *        The Sharded Hash Table holds it's shards, and the Hash functions that choose the shard
+ *        of a key. Only the shards change after the table is created, so the table itself is
+ *        read without a lock.
+ */
+typedef struct ShardedTable
+{
+    Shard *shards;
+    size_t numberOfShards;
+    bool exclusiveReads;
+
+    // Shard Functions.
+    HashFcn hfun;
+    HashFcn64 hfun64;
+} ShardedTable;
+
+
+/*-----=  Sharded Table Functions  =-----*/
+
+
+/**
+ * @brief Mixes the given Hash Code by the finalizer of MurmurHash3, so every bit of the result
+ *        depends on every bit of the Hash Code.
+ * @param hashCode The Hash Code of a key.
+ * @return The mixed Hash Code.
+ */
+static inline uint64_t mixShardHashCode(uint64_t hashCode)
+{
+    hashCode ^= hashCode >> SHARD_MIX_SHIFT;
+    hashCode *= SHARD_MIX_MULTIPLIER_1;
+    hashCode ^= hashCode >> SHARD_MIX_SHIFT;
+    hashCode *= SHARD_MIX_MULTIPLIER_2;
+    hashCode ^= hashCode >> SHARD_MIX_SHIFT;
+    return hashCode;
+}
+
+/**
+ * @brief Returns the shard of the given key, chosen by the low bits of it's mixed Hash Code.
+ *        The shard Tables reduce the same Hash Code to a cell by a multiplication which keeps
+ *        it's structure, so the shard is chosen by an independent finalizer, or else the keys
+ *        of a shard would all fall in a narrow part of it's cells.
+ *        If the Hash function returns an invalid Hash Code, GENERAL_ERROR is reported.
+ * @param table A pointer for the Sharded Hash Table.
+ * @param key The key.
+ * @return A pointer to the shard of the key, or NULL if the Hash Code is invalid.
+ */
+static Shard *getKeyShard(const ShardedTableP table, const void *key)
+{
+    assert(table != NULL && key != NULL);
+
+    uint64_t hashCode = 0;
+    if ((table -> hfun64) != NULL)
+    {
+        hashCode = (table -> hfun64)(key);
+    }
+    else
+    {
+        int fullHashCode = (table -> hfun)(key, FULL_HASH_RANGE);
+        if (fullHashCode < HASH_CODE_LOWER_BOUND)
+        {
+            reportError(GENERAL_ERROR);
+            return NULL;
+        }
+        hashCode = (uint64_t)fullHashCode;
+    }
+
+    // The low half of the mixed Hash Code is scaled to the number of shards.
+    uint64_t mixedHashCode = mixShardHashCode(hashCode) & SHARD_HASH_MASK;
+    size_t shard = (size_t)((mixedHashCode * (table -> numberOfShards)) >> SHARD_HASH_SHIFT);
+    return &((table -> shards)[shard]);
+}
+
+/**
+ * @brief Free the given number of first shards of the Sharded Hash Table, with their locks.
+ * @param table A pointer for the Sharded Hash Table.
+ * @param numberOfShards The number of shards to free.
+ */
+static void freeShards(ShardedTableP table, size_t numberOfShards)
+{
+    assert(table != NULL);
+
+    for (size_t i = INITIAL_INDEX; i < numberOfShards; i++)
+    {
+        pthread_rwlock_destroy(&((table -> shards)[i].lock));
+        freeTable((table -> shards)[i].table);
+    }
+    free(table -> shards);
+    table -> shards = NULL;
+}
+
+/**
+ * @brief Allocate memory for a Sharded Hash Table of the given number of shards, each of them a
+ *        Hash Table of shardSize cells created with the given options and functions.
+ *        The shard of a key is chosen by options -> hfun64 if it is set, otherwise by
+ *        hfun(key, INT_MAX), so one of them must be given. All the given functions must be safe
+ *        to call from several threads at once. The options may not hold a shared keyArena,
+ *        arenaKeys gives each shard an arena of it's own.
+ *        If the options are invalid report GENERAL_ERROR and return NULL.
+ *        If run out of memory, free all the memory that was already allocated by the function,
+ *        report error MEM_OUT to the standard error and return NULL.
+ * @param numberOfShards The number of shards, at least 1.
+ * @param shardSize The number of cells in each shard.
+ * @param options A pointer for the options of every shard.
+ * @param cloneKey A pointer for the Key Cloning function.
+ * @param freeKey A pointer for the Free Key function.
+ * @param hfun A pointer for the Hash function, may be NULL if the options hold a 64 bit one.
+ * @param printKeyFun A pointer for the Print Key function.
+ * @param printDataFun A pointer for the Print Data function.
+ * @param fcomp A pointer for the Key Comparison function.
+ * @return A pointer for the new Sharded Hash Table, or NULL if the process failed.
+ */
+ShardedTableP createShardedTable(size_t numberOfShards, size_t shardSize, const TableOptions *options,
+                                 CloneKeyFcn cloneKey, FreeKeyFcn freeKey, HashFcn hfun,
+                                 PrintKeyFcn printKeyFun, PrintDataFcn printDataFun,
+                                 ComparisonFcn fcomp)
+{
+    // A shared Key Arena would be written by the shards at once, so each shard needs it's own.
+    if (numberOfShards < MINIMAL_NUMBER_OF_SHARDS || options == NULL
+        || (hfun == NULL && (options -> hfun64) == NULL) || (options -> keyArena) != NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    ShardedTableP table = (ShardedTableP)malloc(sizeof(ShardedTable));
+    if (table == NULL)
+    {
+        reportError(MEM_OUT);
+        return NULL;
+    }
+    table -> shards = (Shard *)calloc(numberOfShards, sizeof(Shard));
+    if (table -> shards == NULL)
+    {
+        free(table);
+        reportError(MEM_OUT);
+        return NULL;
+    }
+    table -> numberOfShards = numberOfShards;
+    table -> exclusiveReads = (options -> growthMode) == INCREMENTAL_GROWTH;
+    table -> hfun = hfun;
+    table -> hfun64 = options -> hfun64;
+
+    for (size_t i = INITIAL_INDEX; i < numberOfShards; i++)
+    {
+        Shard *pShard = &((table -> shards)[i]);
+        // The creation of the shard already reports of it's errors.
+        pShard -> table = createTableWithOptions(shardSize, options, cloneKey, freeKey, hfun,
+                                                 printKeyFun, printDataFun, fcomp);
+        if (pShard -> table == NULL)
+        {
+            freeShards(table, i);
+            free(table);
+            return NULL;
+        }
+        if (pthread_rwlock_init(&(pShard -> lock), NULL) != LOCK_SUCCESS)
+        {
+            freeTable(pShard -> table);
+            freeShards(table, i);
+            free(table);
+            reportError(MEM_OUT);
+            return NULL;
+        }
+    }
+    return table;
+}
+
+/**
+ * @brief Insert an object to the shard of the key, or replace the object of the key, as with
+ *        upsert, under the write lock of the shard.
+ * @param table A pointer for the Sharded Hash Table to insert to.
+ * @param key The key to insert.
+ * @param object The object that is stored by the given key.
+ * @param previous A pointer to update with the replaced object, or NULL.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int shardedUpsert(ShardedTableP table, const void *key, DataP object, DataP *previous)
+{
+    if (table == NULL || key == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return false;
+    }
+
+    Shard *pShard = getKeyShard(table, key);
+    if (pShard == NULL)
+    {
+        return false;
+    }
+
+    pthread_rwlock_wrlock(&(pShard -> lock));
+    int result = upsert(pShard -> table, key, object, previous);
+    pthread_rwlock_unlock(&(pShard -> lock));
+    return result;
+}
+
+/**
+ * @brief Insert an object to the shard of the key, as with insert, under the write lock of
+ *        the shard.
+ * @param table A pointer for the Sharded Hash Table to insert to.
+ * @param key The key to insert.
+ * @param object The object that is stored by the given key.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int shardedInsert(ShardedTableP table, const void *key, DataP object)
+{
+    return shardedUpsert(table, key, object, NULL);
+}
+
+/**
+ * @brief Remove the object of the given key from it's shard, as with removeData, under the
+ *        write lock of the shard.
+ * @param table A pointer for the Sharded Hash Table to remove from.
+ * @param key The key to remove.
+ * @return A pointer for the ejected data, or NULL if the key was not found.
+ */
+DataP shardedRemoveData(ShardedTableP table, const void *key)
+{
+    if (table == NULL || key == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+
+    Shard *pShard = getKeyShard(table, key);
+    if (pShard == NULL)
+    {
+        return NULL;
+    }
+
+    pthread_rwlock_wrlock(&(pShard -> lock));
+    DataP removedData = removeData(pShard -> table, key);
+    pthread_rwlock_unlock(&(pShard -> lock));
+    return removedData;
+}
+
+/**
+ * @brief Search the shard of the given key for it's object, under the read lock of the shard,
+ *        so several threads search a shard at once. The shards of an INCREMENTAL_GROWTH table
+ *        move their cells during a search, so they are searched under their write lock.
+ * @param table A pointer for the Sharded Hash Table to search in.
+ * @param key The key to search.
+ * @return A pointer to the data if found, otherwise return NULL.
+ */
+DataP shardedFindData(const ShardedTableP table, const void *key)
+{
+    size_t shard = SIZE_MAX;
+    size_t arrCell = SIZE_MAX;
+    size_t listNode = SIZE_MAX;
+    return shardedFindData64(table, key, &shard, &arrCell, &listNode);
+}
+
+/**
+ * @brief Same as shardedFindData, but fill the shard of the object into shard, and it's cell
+ *        and node positions in the shard into arrCell and listNode.
+ * @param table A pointer for the Sharded Hash Table to search in.
+ * @param key The key to search.
+ * @param shard A pointer to update with the index of the shard of the key.
+ * @param arrCell A pointer to update with the cell of the key in it's shard.
+ * @param listNode A pointer to update with the node of the key in it's cell.
+ * @return A pointer to the data if found, otherwise return NULL.
+ */
+DataP shardedFindData64(const ShardedTableP table, const void *key, size_t *shard,
+                        size_t *arrCell, size_t *listNode)
+{
+    if (table == NULL || key == NULL || shard == NULL || arrCell == NULL || listNode == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return NULL;
+    }
+    *shard = SIZE_MAX;
+    *arrCell = SIZE_MAX;
+    *listNode = SIZE_MAX;
+
+    Shard *pShard = getKeyShard(table, key);
+    if (pShard == NULL)
+    {
+        return NULL;
+    }
+
+    if (table -> exclusiveReads)
+    {
+        pthread_rwlock_wrlock(&(pShard -> lock));
+    }
+    else
+    {
+        pthread_rwlock_rdlock(&(pShard -> lock));
+    }
+    DataP foundData = findData64(pShard -> table, key, arrCell, listNode);
+    pthread_rwlock_unlock(&(pShard -> lock));
+    if (foundData != NULL)
+    {
+        *shard = (size_t)(pShard - (table -> shards));
+    }
+    return foundData;
+}
+
+/**
+ * @brief Grow each shard, under it's own write lock, so the given number of objects would be
+ *        inserted to the table without any further resize, assuming they spread evenly over
+ *        the shards. The other shards keep working while a shard grows.
+ * @param table A pointer for the Sharded Hash Table.
+ * @param expectedElements The number of objects the table should hold.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int shardedReserveTable(ShardedTableP table, size_t expectedElements)
+{
+    if (table == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return false;
+    }
+
+    size_t shardElements = (expectedElements + (table -> numberOfShards) - 1) / (table -> numberOfShards);
+    for (size_t i = INITIAL_INDEX; i < (table -> numberOfShards); i++)
+    {
+        Shard *pShard = &((table -> shards)[i]);
+        pthread_rwlock_wrlock(&(pShard -> lock));
+        int reserved = reserveTable(pShard -> table, shardElements);
+        pthread_rwlock_unlock(&(pShard -> lock));
+        if (!reserved)
+        {
+            // The reserveTable function already reports of the error.
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Print each shard of the Sharded Hash Table, one after the other, under it's read lock.
+ * @param table A pointer to the Sharded Hash Table to print.
+ */
+void printShardedTable(const ShardedTableP table)
+{
+    if (table == NULL)
+    {
+        reportError(GENERAL_ERROR);
+        return;
+    }
+
+    for (size_t i = INITIAL_INDEX; i < (table -> numberOfShards); i++)
+    {
+        Shard *pShard = &((table -> shards)[i]);
+        pthread_rwlock_rdlock(&(pShard -> lock));
+        printf(SHARD_PRINT, i);
+        printTable(pShard -> table);
+        pthread_rwlock_unlock(&(pShard -> lock));
+    }
+}
+
+/**
+ * @brief Free all the memory allocated for the Sharded Hash Table and it's shards.
+ *        No other thread may use the table during or after the call.
+ * @param table A pointer to the Sharded Hash Table to free.
+ */
+void freeShardedTable(ShardedTableP table)
+{
+    if (table != NULL)
+    {
+        freeShards(table, table -> numberOfShards);
+        free(table);
+    }
+}
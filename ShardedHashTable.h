@@ -0,0 +1,151 @@
+#ifndef _SHARDED_HASH_TABLE_H_
+#define _SHARDED_HASH_TABLE_H_
+
+/**
+ * @file ShardedHashTable.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header file for the Sharded Hash Table. It declares a thread-safe Hash Table which
+ *        partitions it's keys between several independent Generic Hash Tables, each guarded by
+ *        it's own reader-writer lock.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header file for the Sharded Hash Table. It declares a thread-safe Hash Table which
+ * partitions it's keys between several independent Generic Hash Tables, each guarded by
+ * it's own reader-writer lock.
+ * Input:       No particular input.
+ * Process:     The shard of a key is chosen by the high bits of it's mixed Hash Code, so threads
+ *              which work on different shards never wait for each other, and a shard resizes
+ *              under it's own lock while the other shards keep working.
+ * Output:      No particular output.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stddef.h>
+#include "GenericHashTable.h"
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * ShardedTableP is a pointer for a Sharded Hash Table.
+ */
+typedef struct ShardedTable *ShardedTableP;
+
+
+/*-----=  Forward Declarations  =-----*/
+
+
+/**
+ * @brief Allocate memory for a Sharded Hash Table of the given number of shards, each of them a
+ *        Hash Table of shardSize cells created with the given options and functions.
+ *        The shard of a key is chosen by options -> hfun64 if it is set, otherwise by
+ *        hfun(key, INT_MAX), so one of them must be given. All the given functions must be safe
+ *        to call from several threads at once. The options may not hold a shared keyArena,
+ *        arenaKeys gives each shard an arena of it's own.
+ *        If the options are invalid report GENERAL_ERROR and return NULL.
+ *        If run out of memory, free all the memory that was already allocated by the function,
+ *        report error MEM_OUT to the standard error and return NULL.
+ * @param numberOfShards The number of shards, at least 1.
+ * @param shardSize The number of cells in each shard.
+ * @param options A pointer for the options of every shard.
+ * @param cloneKey A pointer for the Key Cloning function.
+ * @param freeKey A pointer for the Free Key function.
+ * @param hfun A pointer for the Hash function, may be NULL if the options hold a 64 bit one.
+ * @param printKeyFun A pointer for the Print Key function.
+ * @param printDataFun A pointer for the Print Data function.
+ * @param fcomp A pointer for the Key Comparison function.
+ * @return A pointer for the new Sharded Hash Table, or NULL if the process failed.
+ */
+ShardedTableP createShardedTable(size_t numberOfShards, size_t shardSize, const TableOptions *options,
+                                 CloneKeyFcn cloneKey, FreeKeyFcn freeKey, HashFcn hfun,
+                                 PrintKeyFcn printKeyFun, PrintDataFcn printDataFun,
+                                 ComparisonFcn fcomp);
+
+/**
+ * @brief Insert an object to the shard of the key, as with insert, under the write lock of
+ *        the shard.
+ * @param table A pointer for the Sharded Hash Table to insert to.
+ * @param key The key to insert.
+ * @param object The object that is stored by the given key.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int shardedInsert(ShardedTableP table, const void *key, DataP object);
+
+/**
+ * @brief Insert an object to the shard of the key, or replace the object of the key, as with
+ *        upsert, under the write lock of the shard.
+ * @param table A pointer for the Sharded Hash Table to insert to.
+ * @param key The key to insert.
+ * @param object The object that is stored by the given key.
+ * @param previous A pointer to update with the replaced object, or NULL.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int shardedUpsert(ShardedTableP table, const void *key, DataP object, DataP *previous);
+
+/**
+ * @brief Remove the object of the given key from it's shard, as with removeData, under the
+ *        write lock of the shard.
+ * @param table A pointer for the Sharded Hash Table to remove from.
+ * @param key The key to remove.
+ * @return A pointer for the ejected data, or NULL if the key was not found.
+ */
+DataP shardedRemoveData(ShardedTableP table, const void *key);
+
+/**
+ * @brief Search the shard of the given key for it's object, under the read lock of the shard,
+ *        so several threads search a shard at once. The shards of an INCREMENTAL_GROWTH table
+ *        move their cells during a search, so they are searched under their write lock.
+ * @param table A pointer for the Sharded Hash Table to search in.
+ * @param key The key to search.
+ * @return A pointer to the data if found, otherwise return NULL.
+ */
+DataP shardedFindData(const ShardedTableP table, const void *key);
+
+/**
+ * @brief Same as shardedFindData, but fill the shard of the object into shard, and it's cell
+ *        and node positions in the shard into arrCell and listNode, as with findData64.
+ *        If the key was not found, fill the three pointers with SIZE_MAX.
+ * @param table A pointer for the Sharded Hash Table to search in.
+ * @param key The key to search.
+ * @param shard A pointer to update with the index of the shard of the key.
+ * @param arrCell A pointer to update with the cell of the key in it's shard.
+ * @param listNode A pointer to update with the node of the key in it's cell.
+ * @return A pointer to the data if found, otherwise return NULL.
+ */
+DataP shardedFindData64(const ShardedTableP table, const void *key, size_t *shard,
+                        size_t *arrCell, size_t *listNode);
+
+/**
+ * @brief Grow each shard, under it's own write lock, so the given number of objects would be
+ *        inserted to the table without any further resize, assuming they spread evenly over
+ *        the shards.
+ * @param table A pointer for the Sharded Hash Table.
+ * @param expectedElements The number of objects the table should hold.
+ * @return true (non-zero value) if completed with no errors, false (zero value) otherwise.
+ */
+int shardedReserveTable(ShardedTableP table, size_t expectedElements);
+
+/**
+ * @brief Print each shard of the Sharded Hash Table, one after the other, under it's read lock.
+ * @param table A pointer to the Sharded Hash Table to print.
+ */
+void printShardedTable(const ShardedTableP table);
+
+/**
+ * @brief Free all the memory allocated for the Sharded Hash Table and it's shards.
+ *        No other thread may use the table during or after the call.
+ * @param table A pointer to the Sharded Hash Table to free.
+ */
+void freeShardedTable(ShardedTableP table);
+
+#endif // _SHARDED_HASH_TABLE_H_
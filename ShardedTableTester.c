@@ -0,0 +1,258 @@
+/**
+ * @file ShardedTableTester.c
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Tester for the Sharded Hash Table.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Tester for the Sharded Hash Table.
+ * Input:       No particular input.
+ * Process:     Checks that the keys of each shard spread over all of it's cells, for a plain and
+ *              for a 64 bit Hash function, and that threads which insert, search and remove
+ *              keys at once see every key with it's own object.
+ * Output:      The result of each check, and EXIT_FAILURE if any of them failed.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "ShardedHashTable.h"
+#include "MyIntFunctions.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def NUMBER_OF_SHARDS 8
+ * @brief A Macro that sets the number of shards of a tested table.
+ */
+#define NUMBER_OF_SHARDS 8
+
+/**
+ * @def SHARD_SIZE 1024
+ * @brief A Macro that sets the number of cells of each shard of a tested table.
+ */
+#define SHARD_SIZE 1024
+
+/**
+ * @def OCCUPANCY_KEYS 4096
+ * @brief A Macro that sets the number of keys inserted by the occupancy check, half a key per
+ *        cell, so no shard grows.
+ */
+#define OCCUPANCY_KEYS (NUMBER_OF_SHARDS * SHARD_SIZE / 2)
+
+/**
+ * @def MIN_OCCUPANCY 0.3
+ * @brief A Macro that sets the least part of the cells of each shard which hold a key.
+ *        Half a key per cell, spread at random, occupies about 39% of the cells.
+ */
+#define MIN_OCCUPANCY 0.3
+
+/**
+ * @def NUMBER_OF_WRITERS 4
+ * @brief A Macro that sets the number of threads which write to the table at once.
+ */
+#define NUMBER_OF_WRITERS 4
+
+/**
+ * @def KEYS_PER_WRITER 20000
+ * @brief A Macro that sets the number of keys each writer inserts.
+ */
+#define KEYS_PER_WRITER 20000
+
+/**
+ * @def REMOVED_KEY_STEP 3
+ * @brief A Macro that sets the step between the keys each writer removes again.
+ */
+#define REMOVED_KEY_STEP 3
+
+
+/*-----=  Structs  =-----*/
+
+
+/**
+ * @brief A Structure representing the work of a single writer, which inserts a range of keys,
+ *        searches them and removes some of them.
+ */
+typedef struct WriterTask
+{
+    ShardedTableP table;
+    int *keys;
+    size_t firstKey;
+    size_t numberOfKeys;
+    bool failed;
+} WriterTask;
+
+
+/*-----=  Test Functions  =-----*/
+
+
+/**
+ * @brief Inserts half a key per cell to a Sharded Hash Table, and checks that in each shard
+ *        at least MIN_OCCUPANCY of the cells hold a key.
+ * @param name The name of the check.
+ * @param hfun A pointer for the Hash function, or NULL to use the 64 bit one.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testShardOccupancy(const char *name, HashFcn hfun)
+{
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.growthMode = REHASH_GROWTH;
+    if (hfun == NULL)
+    {
+        options.hfun64 = intMixFcn64;
+    }
+    ShardedTableP table = createShardedTable(NUMBER_OF_SHARDS, SHARD_SIZE, &options, cloneInt,
+                                             freeInt, hfun, intPrint, intPrint, intCompare);
+    if (table == NULL)
+    {
+        return false;
+    }
+
+    static int keys[OCCUPANCY_KEYS];
+    bool occupied[NUMBER_OF_SHARDS][SHARD_SIZE] = {{false}};
+    size_t occupiedCells[NUMBER_OF_SHARDS] = {0};
+    bool passed = true;
+    for (size_t i = 0; i < OCCUPANCY_KEYS; i++)
+    {
+        keys[i] = (int)i;
+        passed = passed && shardedInsert(table, &keys[i], &keys[i]);
+    }
+
+    for (size_t i = 0; passed && i < OCCUPANCY_KEYS; i++)
+    {
+        size_t shard = SIZE_MAX;
+        size_t arrCell = SIZE_MAX;
+        size_t listNode = SIZE_MAX;
+        if (shardedFindData64(table, &keys[i], &shard, &arrCell, &listNode) != &keys[i]
+            || shard >= NUMBER_OF_SHARDS || arrCell >= SHARD_SIZE)
+        {
+            passed = false;
+            break;
+        }
+        occupiedCells[shard] += !occupied[shard][arrCell];
+        occupied[shard][arrCell] = true;
+    }
+
+    for (size_t shard = 0; passed && shard < NUMBER_OF_SHARDS; shard++)
+    {
+        double occupancy = (double)occupiedCells[shard] / SHARD_SIZE;
+        printf("%s: shard %zu occupies %.2f of it's cells\n", name, shard, occupancy);
+        passed = occupancy >= MIN_OCCUPANCY;
+    }
+    freeShardedTable(table);
+    return passed;
+}
+
+/**
+ * @brief Inserts the range of keys of a writer, checks that each of them is found with it's
+ *        object, and removes every REMOVED_KEY_STEP key of them.
+ * @param arg A pointer to the WriterTask of the thread.
+ * @return NULL.
+ */
+static void *runWriter(void *arg)
+{
+    WriterTask *task = (WriterTask *)arg;
+    for (size_t i = task -> firstKey; i < (task -> firstKey) + (task -> numberOfKeys); i++)
+    {
+        task -> keys[i] = (int)i;
+        if (!shardedInsert(task -> table, &(task -> keys[i]), &(task -> keys[i])))
+        {
+            task -> failed = true;
+        }
+    }
+    for (size_t i = task -> firstKey; i < (task -> firstKey) + (task -> numberOfKeys); i++)
+    {
+        if (shardedFindData(task -> table, &(task -> keys[i])) != &(task -> keys[i]))
+        {
+            task -> failed = true;
+        }
+        if (i % REMOVED_KEY_STEP == 0
+            && shardedRemoveData(task -> table, &(task -> keys[i])) != &(task -> keys[i]))
+        {
+            task -> failed = true;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Runs NUMBER_OF_WRITERS writers on a single table at once, and checks that afterwards
+ *        exactly the keys they did not remove are in the table.
+ * @return true if the check passed, false otherwise.
+ */
+static bool testConcurrentWriters()
+{
+    TableOptions options;
+    setDefaultTableOptions(&options);
+    options.hfun64 = intMixFcn64;
+    ShardedTableP table = createShardedTable(NUMBER_OF_SHARDS, NUMBER_OF_SHARDS, &options,
+                                             cloneInt, freeInt, NULL, intPrint, intPrint,
+                                             intCompare);
+    if (table == NULL)
+    {
+        return false;
+    }
+
+    static int keys[NUMBER_OF_WRITERS * KEYS_PER_WRITER];
+    WriterTask tasks[NUMBER_OF_WRITERS];
+    pthread_t threads[NUMBER_OF_WRITERS];
+    for (size_t i = 0; i < NUMBER_OF_WRITERS; i++)
+    {
+        tasks[i] = (WriterTask){table, keys, i * KEYS_PER_WRITER, KEYS_PER_WRITER, false};
+        pthread_create(&threads[i], NULL, runWriter, &tasks[i]);
+    }
+
+    bool passed = true;
+    for (size_t i = 0; i < NUMBER_OF_WRITERS; i++)
+    {
+        pthread_join(threads[i], NULL);
+        passed = passed && !(tasks[i].failed);
+    }
+
+    for (size_t i = 0; passed && i < NUMBER_OF_WRITERS * KEYS_PER_WRITER; i++)
+    {
+        DataP expected = (i % REMOVED_KEY_STEP == 0) ? NULL : &keys[i];
+        passed = shardedFindData(table, &keys[i]) == expected;
+    }
+    freeShardedTable(table);
+    return passed;
+}
+
+/**
+ * @brief Prints the result of the given check.
+ * @param name The name of the check.
+ * @param passed Whether the check passed.
+ * @return passed.
+ */
+static bool reportTest(const char *name, bool passed)
+{
+    printf("%s: %s\n", name, passed ? "passed" : "FAILED");
+    return passed;
+}
+
+/**
+ * @brief The main function. Runs the checks of the Sharded Hash Table.
+ * @return EXIT_SUCCESS if all the checks passed, EXIT_FAILURE otherwise.
+ */
+int main()
+{
+    bool passed = true;
+    passed &= reportTest("Occupancy with intFcn", testShardOccupancy("intFcn", intFcn));
+    passed &= reportTest("Occupancy with intMixFcn64", testShardOccupancy("intMixFcn64", NULL));
+    passed &= reportTest("Concurrent writers", testConcurrentWriters());
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
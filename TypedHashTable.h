@@ -0,0 +1,335 @@
+#ifndef _TYPED_HASH_TABLE_H_
+#define _TYPED_HASH_TABLE_H_
+
+/**
+ * @file TypedHashTable.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header file for Typed Hash Tables. It defines a macro that generates a Hash Table
+ *        of a single key type and value type, whose Hash and Comparison functions are inlined.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header file for Typed Hash Tables. It defines a macro that generates a Hash Table
+ * of a single key type and value type, whose Hash and Comparison functions are inlined.
+ * Input:       No particular input.
+ * Process:     The keys and values are stored by value in one flat array of entries, which is
+ *              searched by Robin Hood linear probing, so an operation makes no indirect calls
+ *              and no allocation of it's own. The generic TableP API remains for tables whose
+ *              keys are not of a single type.
+ * Output:      No particular output.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <limits.h>
+#include "TableErrorHandle.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def TYPED_TABLE_MIN_CAPACITY 8
+ * @brief A Macro that sets the minimal number of entries of a Typed Hash Table.
+ */
+#define TYPED_TABLE_MIN_CAPACITY 8
+
+/**
+ * @def TYPED_TABLE_FREE_FRACTION 8
+ * @brief A Macro that sets the fraction of the entries of a Typed Hash Table that is kept free,
+ *        i.e. the Table grows once more than 7/8 of it's entries are used.
+ */
+#define TYPED_TABLE_FREE_FRACTION 8
+
+/**
+ * @def TYPED_TABLE_MULTIPLIER 0x9E3779B97F4A7C15
+ * @brief A Macro that sets the multiplier which spreads a Hash Code over the entries of a
+ *        Typed Hash Table, so a plain Hash function such as the key itself is enough.
+ */
+#define TYPED_TABLE_MULTIPLIER UINT64_C(0x9E3779B97F4A7C15)
+
+/**
+ * @def TYPED_TABLE_HASH_BITS 64
+ * @brief A Macro that sets the number of bits of a spread Hash Code.
+ */
+#define TYPED_TABLE_HASH_BITS 64
+
+/**
+ * @def TYPED_TABLE_USED_ENTRY
+ * @brief A Macro that sets the bit which is set in the stored Hash Code of every used entry, so
+ *        an empty entry is all zeros.
+ */
+#define TYPED_TABLE_USED_ENTRY ((size_t)1 << (sizeof(size_t) * CHAR_BIT - 1))
+
+
+/*-----=  Key Functions  =-----*/
+
+
+/**
+ * @brief A Hash function for int keys of a Typed Hash Table.
+ * @param key The key.
+ * @return The Hash Code of the key.
+ */
+static inline size_t typedIntHash(int key)
+{
+    return (size_t)(unsigned int)key;
+}
+
+/**
+ * @brief A Comparison function for int keys of a Typed Hash Table.
+ * @param first The first key.
+ * @param second The second key.
+ * @return true if the keys are equal, false otherwise.
+ */
+static inline bool typedIntEquals(int first, int second)
+{
+    return first == second;
+}
+
+
+/*-----=  Table Generator  =-----*/
+
+
+/**
+ * @def DEFINE_HASH_TABLE(Name, KeyType, ValueType, hashFcn, equalsFcn)
+ * @brief A Macro that generates the Typed Hash Table type Name, which maps keys of KeyType to
+ *        values of ValueType. hashFcn(key) returns the size_t Hash Code of a key, and
+ *        equalsFcn(first, second) returns whether two keys are equal, both are called directly,
+ *        so they may be inline functions or macros.
+ *        The generated functions are:
+ *        Name *NameCreate(size_t expectedElements) - Allocate an empty Table with room for the
+ *            given number of entries. If run out of memory, or the entries could not be
+ *            counted by a size_t, report MEM_OUT and return NULL.
+ *        void NameFree(Name *table) - Free all the memory allocated for the Table.
+ *        bool NameInsert(Name *table, KeyType key, ValueType value) - Insert the value with the
+ *            key, or replace the value of the key. If run out of memory, report MEM_OUT, leave
+ *            the Table as it was and return false.
+ *        ValueType *NameFind(const Name *table, KeyType key) - Return a pointer to the value of
+ *            the key, which is valid until the next insert or remove, or NULL if it is not found.
+ *        bool NameRemove(Name *table, KeyType key, ValueType *removed) - Remove the key, and
+ *            fill it's value into removed if it is not NULL. Return false if it is not found.
+ *        size_t NameCount(const Name *table) - Return the number of entries in the Table.
+ * @param Name The name of the Table type and the prefix of it's functions.
+ * @param KeyType The type of the keys, which are copied into the Table.
+ * @param ValueType The type of the values, which are copied into the Table.
+ * @param hashFcn The Hash function.
+ * @param equalsFcn The Comparison function.
+ */
+#define DEFINE_HASH_TABLE(Name, KeyType, ValueType, hashFcn, equalsFcn)                           \
+                                                                                                  \
+typedef struct Name##Entry                                                                        \
+{                                                                                                 \
+    KeyType key;                                                                                  \
+    ValueType value;                                                                              \
+    size_t hashCode;                                                                              \
+} Name##Entry;                                                                                    \
+                                                                                                  \
+typedef struct Name                                                                               \
+{                                                                                                 \
+    Name##Entry *entries;                                                                         \
+    size_t capacity;                                                                              \
+    size_t mask;                                                                                  \
+    unsigned int shift;                                                                           \
+    size_t numberOfEntries;                                                                       \
+} Name;                                                                                           \
+                                                                                                  \
+static inline size_t Name##Home(const Name *table, size_t hashCode)                               \
+{                                                                                                 \
+    return (size_t)(((uint64_t)hashCode * TYPED_TABLE_MULTIPLIER) >> (table -> shift));           \
+}                                                                                                 \
+                                                                                                  \
+static inline bool Name##Allocate(Name *table, size_t capacity)                                   \
+{                                                                                                 \
+    Name##Entry *entries = (Name##Entry *)calloc(capacity, sizeof(Name##Entry));                  \
+    if (entries == NULL)                                                                          \
+    {                                                                                             \
+        return false;                                                                             \
+    }                                                                                             \
+                                                                                                  \
+    unsigned int capacityBits = 0;                                                                \
+    while (((size_t)1 << capacityBits) < capacity)                                                \
+    {                                                                                             \
+        capacityBits++;                                                                           \
+    }                                                                                             \
+    table -> entries = entries;                                                                   \
+    table -> capacity = capacity;                                                                 \
+    table -> mask = capacity - 1;                                                                 \
+    table -> shift = TYPED_TABLE_HASH_BITS - capacityBits;                                        \
+    return true;                                                                                  \
+}                                                                                                 \
+                                                                                                  \
+/* Place the given entry, swapping it with any entry that is closer to it's home. */              \
+static inline Name##Entry *Name##Place(Name *table, Name##Entry carried)                          \
+{                                                                                                 \
+    Name##Entry *placed = NULL;                                                                   \
+    size_t index = Name##Home(table, carried.hashCode);                                           \
+    size_t distance = 0;                                                                          \
+    while ((table -> entries)[index].hashCode != 0)                                               \
+    {                                                                                             \
+        Name##Entry *current = &((table -> entries)[index]);                                      \
+        size_t currentDistance = (index - Name##Home(table, current -> hashCode))                 \
+                                 & (table -> mask);                                               \
+        if (currentDistance < distance)                                                           \
+        {                                                                                         \
+            Name##Entry swapped = *current;                                                       \
+            *current = carried;                                                                   \
+            carried = swapped;                                                                    \
+            distance = currentDistance;                                                           \
+            if (placed == NULL)                                                                   \
+            {                                                                                     \
+                placed = current;                                                                 \
+            }                                                                                     \
+        }                                                                                         \
+        index = (index + 1) & (table -> mask);                                                    \
+        distance++;                                                                               \
+    }                                                                                             \
+    (table -> entries)[index] = carried;                                                          \
+    return (placed != NULL) ? placed : &((table -> entries)[index]);                              \
+}                                                                                                 \
+                                                                                                  \
+static inline bool Name##Resize(Name *table, size_t capacity)                                     \
+{                                                                                                 \
+    Name oldTable = *table;                                                                       \
+    if (!Name##Allocate(table, capacity))                                                         \
+    {                                                                                             \
+        return false;                                                                             \
+    }                                                                                             \
+    for (size_t i = 0; i < oldTable.capacity; i++)                                                \
+    {                                                                                             \
+        if (oldTable.entries[i].hashCode != 0)                                                    \
+        {                                                                                         \
+            Name##Place(table, oldTable.entries[i]);                                              \
+        }                                                                                         \
+    }                                                                                             \
+    free(oldTable.entries);                                                                       \
+    return true;                                                                                  \
+}                                                                                                 \
+                                                                                                  \
+static inline Name *Name##Create(size_t expectedElements)                                         \
+{                                                                                                 \
+    size_t capacity = TYPED_TABLE_MIN_CAPACITY;                                                   \
+    while (capacity - capacity / TYPED_TABLE_FREE_FRACTION < expectedElements)                    \
+    {                                                                                             \
+        if (capacity > SIZE_MAX / (2 * sizeof(Name##Entry)))                                      \
+        {                                                                                         \
+            reportError(MEM_OUT);                                                                 \
+            return NULL;                                                                          \
+        }                                                                                         \
+        capacity *= 2;                                                                            \
+    }                                                                                             \
+                                                                                                  \
+    Name *table = (Name *)malloc(sizeof(Name));                                                   \
+    if (table == NULL || !Name##Allocate(table, capacity))                                        \
+    {                                                                                             \
+        free(table);                                                                              \
+        reportError(MEM_OUT);                                                                     \
+        return NULL;                                                                              \
+    }                                                                                             \
+    table -> numberOfEntries = 0;                                                                 \
+    return table;                                                                                 \
+}                                                                                                 \
+                                                                                                  \
+static inline void Name##Free(Name *table)                                                        \
+{                                                                                                 \
+    if (table != NULL)                                                                            \
+    {                                                                                             \
+        free(table -> entries);                                                                   \
+        free(table);                                                                              \
+    }                                                                                             \
+}                                                                                                 \
+                                                                                                  \
+static inline Name##Entry *Name##FindEntry(const Name *table, KeyType key, size_t hashCode)       \
+{                                                                                                 \
+    size_t index = Name##Home(table, hashCode);                                                   \
+    for (size_t distance = 0; (table -> entries)[index].hashCode != 0; distance++)                \
+    {                                                                                             \
+        Name##Entry *current = &((table -> entries)[index]);                                      \
+        if (((index - Name##Home(table, current -> hashCode)) & (table -> mask)) < distance)      \
+        {                                                                                         \
+            break;                                                                                \
+        }                                                                                         \
+        if ((current -> hashCode) == hashCode && equalsFcn(current -> key, key))                  \
+        {                                                                                         \
+            return current;                                                                       \
+        }                                                                                         \
+        index = (index + 1) & (table -> mask);                                                    \
+    }                                                                                             \
+    return NULL;                                                                                  \
+}                                                                                                 \
+                                                                                                  \
+static inline ValueType *Name##Find(const Name *table, KeyType key)                               \
+{                                                                                                 \
+    Name##Entry *entry = Name##FindEntry(table, key, hashFcn(key) | TYPED_TABLE_USED_ENTRY);      \
+    return (entry != NULL) ? &(entry -> value) : NULL;                                            \
+}                                                                                                 \
+                                                                                                  \
+static inline bool Name##Insert(Name *table, KeyType key, ValueType value)                        \
+{                                                                                                 \
+    size_t hashCode = hashFcn(key) | TYPED_TABLE_USED_ENTRY;                                      \
+    Name##Entry *entry = Name##FindEntry(table, key, hashCode);                                   \
+    if (entry != NULL)                                                                            \
+    {                                                                                             \
+        entry -> value = value;                                                                   \
+        return true;                                                                              \
+    }                                                                                             \
+                                                                                                  \
+    size_t capacity = table -> capacity;                                                          \
+    if ((table -> numberOfEntries) + 1 > capacity - capacity / TYPED_TABLE_FREE_FRACTION          \
+        && !Name##Resize(table, capacity * 2))                                                    \
+    {                                                                                             \
+        reportError(MEM_OUT);                                                                     \
+        return false;                                                                             \
+    }                                                                                             \
+                                                                                                  \
+    Name##Entry newEntry;                                                                         \
+    newEntry.key = key;                                                                           \
+    newEntry.value = value;                                                                       \
+    newEntry.hashCode = hashCode;                                                                 \
+    Name##Place(table, newEntry);                                                                 \
+    (table -> numberOfEntries)++;                                                                 \
+    return true;                                                                                  \
+}                                                                                                 \
+                                                                                                  \
+/* The following entries of the probe sequence are shifted back, so no tombstones are left. */   \
+static inline bool Name##Remove(Name *table, KeyType key, ValueType *removed)                     \
+{                                                                                                 \
+    Name##Entry *hole = Name##FindEntry(table, key, hashFcn(key) | TYPED_TABLE_USED_ENTRY);       \
+    if (hole == NULL)                                                                             \
+    {                                                                                             \
+        return false;                                                                             \
+    }                                                                                             \
+    if (removed != NULL)                                                                          \
+    {                                                                                             \
+        *removed = hole -> value;                                                                 \
+    }                                                                                             \
+                                                                                                  \
+    size_t index = (size_t)(hole - (table -> entries));                                           \
+    size_t nextIndex = (index + 1) & (table -> mask);                                             \
+    while ((table -> entries)[nextIndex].hashCode != 0                                            \
+           && Name##Home(table, (table -> entries)[nextIndex].hashCode) != nextIndex)             \
+    {                                                                                             \
+        (table -> entries)[index] = (table -> entries)[nextIndex];                                \
+        index = nextIndex;                                                                        \
+        nextIndex = (nextIndex + 1) & (table -> mask);                                            \
+    }                                                                                             \
+    (table -> entries)[index].hashCode = 0;                                                       \
+    (table -> numberOfEntries)--;                                                                 \
+    return true;                                                                                  \
+}                                                                                                 \
+                                                                                                  \
+static inline size_t Name##Count(const Name *table)                                               \
+{                                                                                                 \
+    return table -> numberOfEntries;                                                              \
+}
+
+#endif // _TYPED_HASH_TABLE_H_